@@ -53,22 +53,35 @@ namespace tatum {
  * The 'HoldAnalysis' class defines the operations needed by a timing analyzer
  * to perform a hold (min/shortest path) analysis.
  *
+ * The operations are implemented by BasicHoldAnalysis, which may be specialized on
+ * the concrete delay calculator type, so delay lookups can be inlined (see
+ * CommonAnalysisVisitor). 'HoldAnalysis' is the general version, which uses the
+ * DelayCalculator interface.
+ *
  * \see SetupAnalysis
  * \see TimingAnalyzer
  * \see CommonAnalysisVisitor
  */
-class HoldAnalysis : public detail::CommonAnalysisVisitor<detail::HoldAnalysisOps> {
+template<class DelayCalc=DelayCalculator>
+class BasicHoldAnalysis : public detail::CommonAnalysisVisitor<detail::HoldAnalysisOps,DelayCalc> {
 
     public:
-        HoldAnalysis(size_t num_tags, size_t num_slacks)
-            : detail::CommonAnalysisVisitor<detail::HoldAnalysisOps>(num_tags, num_slacks) {}
+        BasicHoldAnalysis(size_t num_tags, size_t num_slacks)
+            : detail::CommonAnalysisVisitor<detail::HoldAnalysisOps,DelayCalc>(num_tags, num_slacks) {}
 
-        TimingTags::tag_range hold_tags(const NodeId node) const { return ops_.get_tags(node); }
-        TimingTags::tag_range hold_tags(const NodeId node, TagType type) const { return ops_.get_tags(node, type); }
+        TimingTags::tag_range hold_tags(const NodeId node) const { return this->ops_.get_tags(node); }
+        TimingTags::tag_range hold_tags(const NodeId node, TagType type) const { return this->ops_.get_tags(node, type); }
 #ifdef TATUM_CALCULATE_EDGE_SLACKS
-        TimingTags::tag_range hold_edge_slacks(const EdgeId edge) const { return ops_.get_edge_slacks(edge); }
+        TimingTags::tag_range hold_edge_slacks(const EdgeId edge) const { return this->ops_.get_edge_slacks(edge); }
 #endif
-        TimingTags::tag_range hold_node_slacks(const NodeId node) const { return ops_.get_node_slacks(node); }
+        TimingTags::tag_range hold_node_slacks(const NodeId node) const { return this->ops_.get_node_slacks(node); }
+};
+
+///The general hold analysis visitor, which supports any number of clock domains
+class HoldAnalysis : public BasicHoldAnalysis<> {
+    public:
+        HoldAnalysis(size_t num_tags, size_t num_slacks)
+            : BasicHoldAnalysis<>(num_tags, num_slacks) {}
 };
 
 } //namepsace
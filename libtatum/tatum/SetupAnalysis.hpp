@@ -115,27 +115,40 @@ namespace tatum {
  * \see HoldAnalysis
  */
 
-/** \class HoldAnalysis
+/** \class SetupAnalysis
  *
- * The 'HoldAnalysis' class defines the operations needed by a timing analyzer
- * to perform a hold (min/shortest path) analysis.
+ * The 'SetupAnalysis' class defines the operations needed by a timing analyzer
+ * to perform a setup (max/long path) analysis.
  *
- * \see SetupAnalysis
+ * The operations are implemented by BasicSetupAnalysis, which may be specialized on
+ * the concrete delay calculator type, so delay lookups can be inlined (see
+ * CommonAnalysisVisitor). 'SetupAnalysis' is the general version, which uses the
+ * DelayCalculator interface.
+ *
+ * \see HoldAnalysis
  * \see TimingAnalyzer
  * \see CommonAnalysisVisitor
  */
-class SetupAnalysis : public detail::CommonAnalysisVisitor<detail::SetupAnalysisOps> {
+template<class DelayCalc=DelayCalculator>
+class BasicSetupAnalysis : public detail::CommonAnalysisVisitor<detail::SetupAnalysisOps,DelayCalc> {
 
     public:
-        SetupAnalysis(size_t num_tags, size_t num_slacks)
-            : detail::CommonAnalysisVisitor<detail::SetupAnalysisOps>(num_tags, num_slacks) {}
+        BasicSetupAnalysis(size_t num_tags, size_t num_slacks)
+            : detail::CommonAnalysisVisitor<detail::SetupAnalysisOps,DelayCalc>(num_tags, num_slacks) {}
 
-        TimingTags::tag_range setup_tags(const NodeId node) const { return ops_.get_tags(node); }
-        TimingTags::tag_range setup_tags(const NodeId node, TagType type) const { return ops_.get_tags(node, type); }
+        TimingTags::tag_range setup_tags(const NodeId node) const { return this->ops_.get_tags(node); }
+        TimingTags::tag_range setup_tags(const NodeId node, TagType type) const { return this->ops_.get_tags(node, type); }
 #ifdef TATUM_CALCULATE_EDGE_SLACKS
-        TimingTags::tag_range setup_edge_slacks(const EdgeId edge) const { return ops_.get_edge_slacks(edge); }
+        TimingTags::tag_range setup_edge_slacks(const EdgeId edge) const { return this->ops_.get_edge_slacks(edge); }
 #endif
-        TimingTags::tag_range setup_node_slacks(const NodeId node) const { return ops_.get_node_slacks(node); }
+        TimingTags::tag_range setup_node_slacks(const NodeId node) const { return this->ops_.get_node_slacks(node); }
+};
+
+///The general setup analysis visitor, which supports any number of clock domains
+class SetupAnalysis : public BasicSetupAnalysis<> {
+    public:
+        SetupAnalysis(size_t num_tags, size_t num_slacks)
+            : BasicSetupAnalysis<>(num_tags, num_slacks) {}
 };
 
 } //namepsace
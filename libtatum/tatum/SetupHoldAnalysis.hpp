@@ -14,13 +14,17 @@ namespace tatum {
  * Performing both analysis simultaneously tends to be more efficient than performing
  * them sperately due to cache locality.
  *
+ * As with SetupAnalysis and HoldAnalysis the operations are implemented by
+ * BasicSetupHoldAnalysis, which may be specialized on the delay calculator type.
+ *
  * \see SetupAnalysis
  * \see HoldAnalysis
  * \see TimingAnalyzer
  */
-class SetupHoldAnalysis : public GraphVisitor {
+template<class DelayCalc=DelayCalculator>
+class BasicSetupHoldAnalysis : public GraphVisitor {
     public:
-        SetupHoldAnalysis(size_t num_tags, size_t num_slacks)
+        BasicSetupHoldAnalysis(size_t num_tags, size_t num_slacks)
             : setup_visitor_(num_tags, num_slacks)
             , hold_visitor_(num_tags, num_slacks) {}
 
@@ -96,6 +100,31 @@ class SetupHoldAnalysis : public GraphVisitor {
             return setup_modified || hold_modified;
         }
 
+        void pack_tags() {
+            setup_visitor_.pack_tags();
+            hold_visitor_.pack_tags();
+        }
+
+        void set_dominated_tag_pruning(const TimingConstraints& tc, bool enable) {
+            setup_visitor_.set_dominated_tag_pruning(tc, enable);
+            hold_visitor_.set_dominated_tag_pruning(tc, enable);
+        }
+
+        void set_slack_threshold(const Time threshold, size_t num_nodes) {
+            setup_visitor_.set_slack_threshold(threshold, num_nodes);
+            hold_visitor_.set_slack_threshold(threshold, num_nodes);
+        }
+
+        void set_timing_derate(const TimingGraph& tg, const TimingDerate& derate) {
+            setup_visitor_.set_timing_derate(tg, derate);
+            hold_visitor_.set_timing_derate(tg, derate);
+        }
+
+        void set_common_clock_index(std::shared_ptr<const CommonClockIndex> index) {
+            setup_visitor_.set_common_clock_index(index);
+            hold_visitor_.set_common_clock_index(std::move(index));
+        }
+
         TimingTags::tag_range setup_tags(const NodeId node_id) const { return setup_visitor_.setup_tags(node_id); }
         TimingTags::tag_range setup_tags(const NodeId node_id, TagType type) const { return setup_visitor_.setup_tags(node_id, type); }
 #ifdef TATUM_CALCULATE_EDGE_SLACKS
@@ -110,11 +139,18 @@ class SetupHoldAnalysis : public GraphVisitor {
 #endif
         TimingTags::tag_range hold_node_slacks(const NodeId node_id) const { return hold_visitor_.hold_node_slacks(node_id); }
 
-        SetupAnalysis& setup_visitor() { return setup_visitor_; }
-        HoldAnalysis& hold_visitor() { return hold_visitor_; }
+        BasicSetupAnalysis<DelayCalc>& setup_visitor() { return setup_visitor_; }
+        BasicHoldAnalysis<DelayCalc>& hold_visitor() { return hold_visitor_; }
     private:
-        SetupAnalysis setup_visitor_;
-        HoldAnalysis hold_visitor_;
+        BasicSetupAnalysis<DelayCalc> setup_visitor_;
+        BasicHoldAnalysis<DelayCalc> hold_visitor_;
+};
+
+///The general combined setup and hold analysis visitor, which supports any number of clock domains
+class SetupHoldAnalysis : public BasicSetupHoldAnalysis<> {
+    public:
+        SetupHoldAnalysis(size_t num_tags, size_t num_slacks)
+            : BasicSetupHoldAnalysis<>(num_tags, num_slacks) {}
 };
 
 } //namepsace
@@ -0,0 +1,240 @@
+#include "tatum/SlackSummary.hpp"
+
+#include <algorithm>
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/TimingConstraints.hpp"
+#include "tatum/error.hpp"
+
+namespace tatum {
+
+SlackSummary::SlackSummary(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const SetupTimingAnalyzer& setup_analyzer, size_t corner)
+    : SlackSummary(timing_graph, timing_constraints, setup_analyzer, std::make_unique<detail::SetupTagRetriever>(setup_analyzer), corner) {}
+
+SlackSummary::SlackSummary(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const HoldTimingAnalyzer& hold_analyzer, size_t corner)
+    : SlackSummary(timing_graph, timing_constraints, hold_analyzer, std::make_unique<detail::HoldTagRetriever>(hold_analyzer), corner) {}
+
+SlackSummary::SlackSummary(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const TimingAnalyzer& analyzer, std::unique_ptr<detail::TagRetriever> tag_retriever, size_t corner)
+    : timing_graph_(timing_graph)
+    , timing_constraints_(timing_constraints)
+    , analyzer_(analyzer)
+    , tag_retriever_(std::move(tag_retriever))
+    , corner_(corner)
+    , is_endpoint_(timing_graph.nodes().size(), false)
+    , endpoint_domain_pair_slacks_(timing_graph.nodes().size()) {
+    TATUM_ASSERT(corner_ < Time::num_corners());
+
+    for (NodeId node : timing_graph_.logical_outputs()) {
+        is_endpoint_[node] = true;
+    }
+}
+
+std::vector<std::pair<DomainId,DomainId>> SlackSummary::domain_pairs() const {
+    std::vector<std::pair<DomainId,DomainId>> pairs;
+    for (const t_domain_pair_summary& summary : domain_pair_summaries_) {
+        if (summary.endpoint_slacks.empty()) continue;
+
+        pairs.emplace_back(summary.launch_domain, summary.capture_domain);
+    }
+    return pairs;
+}
+
+Time SlackSummary::worst_slack() const {
+    if (endpoint_worst_slacks_.empty()) return Time();
+
+    return Time(endpoint_worst_slacks_.begin()->first);
+}
+
+Time SlackSummary::worst_slack(const DomainId launch_domain, const DomainId capture_domain) const {
+    const t_domain_pair_summary* summary = find_domain_pair(launch_domain, capture_domain);
+    if (!summary || summary->endpoint_slacks.empty()) return Time();
+
+    return Time(summary->endpoint_slacks.begin()->first);
+}
+
+Time SlackSummary::worst_negative_slack() const {
+    if (endpoint_worst_slacks_.empty()) return Time(0.);
+
+    return Time(std::min(0.f, endpoint_worst_slacks_.begin()->first));
+}
+
+Time SlackSummary::worst_negative_slack(const DomainId launch_domain, const DomainId capture_domain) const {
+    const t_domain_pair_summary* summary = find_domain_pair(launch_domain, capture_domain);
+    if (!summary || summary->endpoint_slacks.empty()) return Time(0.);
+
+    return Time(std::min(0.f, summary->endpoint_slacks.begin()->first));
+}
+
+Time SlackSummary::total_negative_slack() const {
+    return Time(total_negative_slack_);
+}
+
+Time SlackSummary::total_negative_slack(const DomainId launch_domain, const DomainId capture_domain) const {
+    const t_domain_pair_summary* summary = find_domain_pair(launch_domain, capture_domain);
+    if (!summary) return Time(0.);
+
+    return Time(summary->total_negative_slack);
+}
+
+std::vector<TimingPathInfo> SlackSummary::critical_paths() const {
+    std::vector<TimingPathInfo> cpds;
+    for (const t_domain_pair_summary& summary : domain_pair_summaries_) {
+        if (summary.endpoint_slacks.empty()) continue;
+
+        cpds.push_back(make_critical_path(summary));
+    }
+    return cpds;
+}
+
+TimingPathInfo SlackSummary::critical_path(const DomainId launch_domain, const DomainId capture_domain) const {
+    const t_domain_pair_summary* summary = find_domain_pair(launch_domain, capture_domain);
+    if (!summary || summary->endpoint_slacks.empty()) {
+        throw Error("No constrained endpoints for the specified domain pair");
+    }
+
+    return make_critical_path(*summary);
+}
+
+Time SlackSummary::endpoint_worst_slack(const NodeId endpoint) const {
+    const auto& domain_pair_slacks = endpoint_domain_pair_slacks_[endpoint];
+    if (domain_pair_slacks.empty()) return Time();
+
+    auto cmp = [](const t_domain_pair_slack& lhs, const t_domain_pair_slack& rhs) {
+        return lhs.slack < rhs.slack;
+    };
+    return Time(std::min_element(domain_pair_slacks.begin(), domain_pair_slacks.end(), cmp)->slack);
+}
+
+std::vector<std::pair<NodeId,Time>> SlackSummary::worst_endpoints(size_t num_endpoints) const {
+    std::vector<std::pair<NodeId,Time>> endpoints;
+    endpoints.reserve(std::min(num_endpoints, endpoint_worst_slacks_.size()));
+
+    for (const t_endpoint_slack& endpoint_slack : endpoint_worst_slacks_) {
+        if (endpoints.size() == num_endpoints) break;
+
+        endpoints.emplace_back(endpoint_slack.second, Time(endpoint_slack.first));
+    }
+    return endpoints;
+}
+
+void SlackSummary::update() {
+    for (NodeId node : analyzer_.modified_nodes()) {
+        if (!is_endpoint_[node]) continue;
+
+        //Replace the endpoint's previous slacks with its current ones
+        remove_endpoint(node);
+        add_endpoint(node);
+    }
+}
+
+void SlackSummary::remove_endpoint(const NodeId endpoint) {
+    auto& domain_pair_slacks = endpoint_domain_pair_slacks_[endpoint];
+    if (domain_pair_slacks.empty()) return; //Was unconstrained
+
+    float worst_slack = domain_pair_slacks[0].slack;
+    for (const t_domain_pair_slack& domain_pair_slack : domain_pair_slacks) {
+        t_domain_pair_summary& summary = domain_pair_summaries_[domain_pair_slack.domain_pair];
+
+        summary.endpoint_slacks.erase(t_endpoint_slack(domain_pair_slack.slack, endpoint));
+        summary.total_negative_slack -= std::min(0.f, domain_pair_slack.slack);
+
+        worst_slack = std::min(worst_slack, domain_pair_slack.slack);
+    }
+
+    endpoint_worst_slacks_.erase(t_endpoint_slack(worst_slack, endpoint));
+    total_negative_slack_ -= std::min(0.f, worst_slack);
+
+    domain_pair_slacks.clear();
+}
+
+void SlackSummary::add_endpoint(const NodeId endpoint) {
+    auto& domain_pair_slacks = endpoint_domain_pair_slacks_[endpoint];
+    TATUM_ASSERT(domain_pair_slacks.empty());
+
+    for (const TimingTag& slack_tag : tag_retriever_->slacks(endpoint)) {
+        Time slack = slack_tag.time();
+        if (!slack.valid()) {
+            throw Error("slack is not valid", endpoint);
+        }
+
+        size_t domain_pair = domain_pair_index(slack_tag.launch_clock_domain(), slack_tag.capture_clock_domain());
+        domain_pair_slacks.push_back({domain_pair, slack.value(corner_)});
+    }
+
+    if (domain_pair_slacks.empty()) return; //Unconstrained
+
+    float worst_slack = domain_pair_slacks[0].slack;
+    for (const t_domain_pair_slack& domain_pair_slack : domain_pair_slacks) {
+        t_domain_pair_summary& summary = domain_pair_summaries_[domain_pair_slack.domain_pair];
+
+        summary.endpoint_slacks.insert(t_endpoint_slack(domain_pair_slack.slack, endpoint));
+        summary.total_negative_slack += std::min(0.f, domain_pair_slack.slack);
+
+        worst_slack = std::min(worst_slack, domain_pair_slack.slack);
+    }
+
+    endpoint_worst_slacks_.insert(t_endpoint_slack(worst_slack, endpoint));
+    total_negative_slack_ += std::min(0.f, worst_slack);
+}
+
+size_t SlackSummary::domain_pair_index(const DomainId launch_domain, const DomainId capture_domain) {
+    auto key = std::make_pair(launch_domain, capture_domain);
+
+    auto iter = domain_pair_indices_.find(key);
+    if (iter != domain_pair_indices_.end()) {
+        return iter->second;
+    }
+
+    //New domain pair
+    size_t index = domain_pair_summaries_.size();
+    domain_pair_summaries_.emplace_back();
+    domain_pair_summaries_[index].launch_domain = launch_domain;
+    domain_pair_summaries_[index].capture_domain = capture_domain;
+
+    domain_pair_indices_[key] = index;
+
+    return index;
+}
+
+const SlackSummary::t_domain_pair_summary* SlackSummary::find_domain_pair(const DomainId launch_domain, const DomainId capture_domain) const {
+    auto iter = domain_pair_indices_.find(std::make_pair(launch_domain, capture_domain));
+    if (iter == domain_pair_indices_.end()) {
+        return nullptr;
+    }
+    return &domain_pair_summaries_[iter->second];
+}
+
+TimingPathInfo SlackSummary::make_critical_path(const t_domain_pair_summary& summary) const {
+    if (type() != TimingType::SETUP) {
+        throw Error("Critical path delay is only defined for setup analysis");
+    }
+    TATUM_ASSERT(!summary.endpoint_slacks.empty());
+
+    //As in find_critical_paths() we calculate CPD as:
+    //
+    //      CPD = constraint - slack
+    //
+    //so the worst (smallest) slack endpoint determines the CPD
+    const t_endpoint_slack& worst = *summary.endpoint_slacks.begin();
+
+    Time slack(worst.first);
+    NodeId endpoint = worst.second;
+
+    Time constraint = timing_constraints_.setup_constraint(summary.launch_domain, summary.capture_domain);
+    if (!constraint.valid()) {
+        throw Error("constraint is not valid", endpoint);
+    }
+
+    Time cpd = constraint - slack;
+    if (!cpd.valid()) {
+        throw Error("cpd is not valid", endpoint);
+    }
+
+    return TimingPathInfo(TimingType::SETUP,
+                          cpd, slack,
+                          NodeId::INVALID(), //We currently don't trace the path back to the start point, so just mark as invalid
+                          endpoint,
+                          summary.launch_domain, summary.capture_domain);
+}
+
+} //namespace
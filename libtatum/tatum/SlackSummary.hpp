@@ -0,0 +1,136 @@
+#ifndef TATUM_SLACK_SUMMARY_HPP
+#define TATUM_SLACK_SUMMARY_HPP
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "tatum/TimingGraphFwd.hpp"
+#include "tatum/TimingConstraintsFwd.hpp"
+#include "tatum/timing_analyzers.hpp"
+#include "tatum/base/TimingType.hpp"
+#include "tatum/report/TimingPath.hpp"
+#include "tatum/report/TimingReportTagRetriever.hpp"
+#include "tatum/util/tatum_linear_map.hpp"
+
+namespace tatum {
+
+/**
+ * An incrementally maintained summary of the slacks at the timing endpoints
+ * (i.e. logical_outputs()).
+ *
+ * For each pair of launch/capture clock domains the worst negative slack (WNS),
+ * total negative slack (TNS) and (for setup) critical path delay (CPD) are tracked,
+ * along with an index of the endpoints ordered by their worst slack.
+ *
+ * Rather than scanning every endpoint, update() re-examines only the endpoints
+ * reported by the analyzer's modified_nodes(). As a result, after an incremental
+ * timing update, updating the summary takes time proportional to the number of
+ * endpoints whose timing changed, and queries are independent of the number of
+ * endpoints (or proportional to the number of endpoints requested).
+ *
+ * Note that update() must be called after *every* timing update, otherwise the
+ * endpoints modified by the skipped update would be missed.
+ *
+ * The TNS across all domain pairs counts each endpoint once (by its worst slack).
+ * It is accumulated incrementally (in double precision), so may differ from a
+ * fresh summation by round-off.
+ *
+ * With multiple timing corners (see Time) the summary tracks the slacks of the
+ * specified corner.
+ */
+class SlackSummary {
+    public:
+        SlackSummary(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const SetupTimingAnalyzer& setup_analyzer, size_t corner=0);
+        SlackSummary(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const HoldTimingAnalyzer& hold_analyzer, size_t corner=0);
+
+    public: //Accessors
+        TimingType type() const { return tag_retriever_->type(); }
+
+        ///Returns the timing corner summarized
+        size_t corner() const { return corner_; }
+
+        ///Returns the (launch, capture) domain pairs with at least one constrained endpoint
+        std::vector<std::pair<DomainId,DomainId>> domain_pairs() const;
+
+        ///Returns the worst slack of any endpoint (invalid if there are no constrained endpoints)
+        Time worst_slack() const;
+        Time worst_slack(const DomainId launch_domain, const DomainId capture_domain) const;
+
+        ///Returns the worst negative slack (i.e. the worst slack if negative, otherwise zero)
+        Time worst_negative_slack() const;
+        Time worst_negative_slack(const DomainId launch_domain, const DomainId capture_domain) const;
+
+        ///Returns the total negative slack
+        Time total_negative_slack() const;
+        Time total_negative_slack(const DomainId launch_domain, const DomainId capture_domain) const;
+
+        ///Returns the critical path (i.e. worst endpoint) of each domain pair, equivalent to
+        ///find_critical_paths(). Only valid for setup analysis.
+        std::vector<TimingPathInfo> critical_paths() const;
+        TimingPathInfo critical_path(const DomainId launch_domain, const DomainId capture_domain) const;
+
+        ///Returns the worst slack of the specified endpoint (invalid if unconstrained)
+        Time endpoint_worst_slack(const NodeId endpoint) const;
+
+        ///Returns (up to) the num_endpoints endpoints with the worst slack, in order of
+        ///increasing slack, paired with their worst slack
+        std::vector<std::pair<NodeId,Time>> worst_endpoints(size_t num_endpoints) const;
+
+    public: //Mutators
+        ///Updates the summary based on the nodes modified by the analyzer's last timing update
+        void update();
+
+    private:
+        //An endpoint slack, ordered by slack (ties broken by node)
+        typedef std::pair<float,NodeId> t_endpoint_slack;
+
+        //The slack of an endpoint for a particular domain pair
+        struct t_domain_pair_slack {
+            size_t domain_pair;
+            float slack;
+        };
+
+        //The slack summary for a particular domain pair
+        struct t_domain_pair_summary {
+            DomainId launch_domain;
+            DomainId capture_domain;
+
+            std::set<t_endpoint_slack> endpoint_slacks;
+            double total_negative_slack = 0.;
+        };
+
+    private:
+        SlackSummary(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const TimingAnalyzer& analyzer, std::unique_ptr<detail::TagRetriever> tag_retriever, size_t corner);
+
+        void remove_endpoint(const NodeId endpoint);
+        void add_endpoint(const NodeId endpoint);
+
+        size_t domain_pair_index(const DomainId launch_domain, const DomainId capture_domain);
+        const t_domain_pair_summary* find_domain_pair(const DomainId launch_domain, const DomainId capture_domain) const;
+
+        TimingPathInfo make_critical_path(const t_domain_pair_summary& summary) const;
+
+    private:
+        const TimingGraph& timing_graph_;
+        const TimingConstraints& timing_constraints_;
+        const TimingAnalyzer& analyzer_;
+        std::unique_ptr<detail::TagRetriever> tag_retriever_;
+        size_t corner_;
+
+        tatum::util::linear_map<NodeId,bool> is_endpoint_;
+
+        //The per-domain pair slacks of each endpoint (as of the last update)
+        tatum::util::linear_map<NodeId,std::vector<t_domain_pair_slack>> endpoint_domain_pair_slacks_;
+
+        std::map<std::pair<DomainId,DomainId>,size_t> domain_pair_indices_;
+        std::vector<t_domain_pair_summary> domain_pair_summaries_;
+
+        //The worst slack of each constrained endpoint
+        std::set<t_endpoint_slack> endpoint_worst_slacks_;
+        double total_negative_slack_ = 0.;
+};
+
+} //namespace
+
+#endif
@@ -2,12 +2,42 @@
 
 #include <cmath>
 #include <array>
+#include <cstdint>
+#include <limits>
 #include <iosfwd>
 
 #ifndef TIME_VEC_WIDTH
 #define TIME_VEC_WIDTH 1
 #endif
 
+/*
+ * Fixed-point time
+ *
+ * If TATUM_FIXED_POINT_TIME is defined times are stored as integer multiples of
+ * TATUM_FIXED_POINT_TIME_RESOLUTION seconds (default 1fs) in a TATUM_FIXED_POINT_TIME_TYPE
+ * (default int64_t, int32_t halves the size of Time at the cost of range), rather than
+ * as floats. Arithmetic and comparisons are then exact integer operations, so results 
+ * do not depend on evaluation order (e.g. serial vs parallel walkers).
+ *
+ * The interface is unchanged (times are still specified and returned in seconds as 
+ * scalar_type), with the smallest and largest integers reserved as sentinels for invalid 
+ * (NaN), -inf and +inf. These follow the same rules as their floating-point equivalents
+ * (e.g. invalid times never compare equal, and inf - inf is invalid). Times are rounded
+ * to the nearest multiple of the resolution (saturating to +/-inf if out of range), but the
+ * results of arithmetic on finite times are assumed not to overflow.
+ */
+#ifdef TATUM_FIXED_POINT_TIME
+# if TIME_VEC_WIDTH > 1
+#  error "TATUM_FIXED_POINT_TIME does not support TIME_VEC_WIDTH > 1"
+# endif
+# ifndef TATUM_FIXED_POINT_TIME_TYPE
+#  define TATUM_FIXED_POINT_TIME_TYPE int64_t
+# endif
+# ifndef TATUM_FIXED_POINT_TIME_RESOLUTION
+#  define TATUM_FIXED_POINT_TIME_RESOLUTION 1e-15
+# endif
+#endif
+
 /*
  * What alignment is required?
  */
@@ -19,27 +49,56 @@
 //Required for aligned access with SSE
 # define TIME_MEM_ALIGN 4*sizeof(float)
 
-#endif //TIME_VEC_WIDTH
+#elif TIME_VEC_WIDTH > 1
+# define TIME_MEM_ALIGN alignof(float)
 
-#if TIME_VEC_WIDTH > 1
-# include <x86intrin.h>
-#endif
+#endif //TIME_VEC_WIDTH
 
 namespace tatum {
 
+/**
+ * A time value.
+ *
+ * If TIME_VEC_WIDTH > 1 each Time holds an independent value per timing corner
+ * (e.g. process/voltage/temperature corner), one per vector lane, so that a single
+ * timing analysis analyzes every corner simultaneously. The delay calculator then 
+ * returns per-corner delays, and all arithmetic and max/min operations apply to each 
+ * corner independently. 
+ *
+ * With multiple corners, value() (and the implicit conversion to scalar_type) return 
+ * the value of corner zero, a time is valid only if it is valid in every corner, and 
+ * the comparison operators are true only if they hold in every corner.
+ */
 class Time {
     public:
         typedef float scalar_type;
+#ifdef TATUM_FIXED_POINT_TIME
+        typedef TATUM_FIXED_POINT_TIME_TYPE tick_type;
+#endif
     public: //Constructors
         Time(): Time(NAN) {}
 
         ///Initialize from float types
+#ifdef TATUM_FIXED_POINT_TIME
+        explicit Time(const double time): time_(to_ticks(time)) {}
+#else
         explicit Time(const double time) { set_value(time); }
+#endif
 
     public: //Accessors
-        ///The current time value
+        ///The number of timing corners
+        constexpr static size_t num_corners() { return TIME_VEC_WIDTH; }
+
+        ///The current time value (of corner zero)
         scalar_type value() const;
 
+        ///The current time value of the specified corner
+        scalar_type value(size_t corner) const;
+
+        ///The smallest/largest value across all corners (NaN if any is invalid)
+        scalar_type min_value() const;
+        scalar_type max_value() const;
+
         ///Indicates whether the current time value is valid
         bool valid() const;
 
@@ -51,22 +110,45 @@ class Time {
         ///Allow conversions to scalar_type (usually float)
         operator scalar_type() const { return value(); }
 
+#ifdef TATUM_FIXED_POINT_TIME
+        ///The raw integer time value (in units of TATUM_FIXED_POINT_TIME_RESOLUTION),
+        ///including the invalid/infinity sentinels
+        tick_type ticks() const { return time_; }
+#endif
+
     public: //Mutators
-        ///Set the current time value to time
+        ///Set the current time value of every corner to time
         void set_value(scalar_type time);
 
+        ///Set the current time value of the specified corner to time
+        void set_value(size_t corner, scalar_type time);
+
 
         Time& operator+=(const Time& rhs);
         Time& operator-=(const Time& rhs);
 
+        ///Scales the time value (of every corner) by factor
+        Time& operator*=(const scalar_type factor);
+
         friend bool operator==(const Time lhs, const Time rhs);
+        friend bool operator!=(const Time lhs, const Time rhs);
         friend bool operator<(const Time lhs, const Time rhs);
         friend bool operator>(const Time lhs, const Time rhs);
         friend Time operator-(const Time val);
         friend Time operator+(const Time val);
 
     private:
-#if TIME_VEC_WIDTH > 1
+#ifdef TATUM_FIXED_POINT_TIME
+        constexpr static tick_type INVALID_TICKS = std::numeric_limits<tick_type>::min();
+        constexpr static tick_type NEG_INF_TICKS = std::numeric_limits<tick_type>::min() + 1;
+        constexpr static tick_type POS_INF_TICKS = std::numeric_limits<tick_type>::max();
+
+        static tick_type to_ticks(const double time);
+        static bool is_finite(const tick_type ticks) { return ticks > NEG_INF_TICKS && ticks < POS_INF_TICKS; }
+        static tick_type add_ticks(const tick_type lhs, const tick_type rhs);
+
+        tick_type time_;
+#elif TIME_VEC_WIDTH > 1
         alignas(TIME_MEM_ALIGN) std::array<scalar_type, TIME_VEC_WIDTH> time_;
 #else
         scalar_type time_;
@@ -9,7 +9,77 @@ namespace tatum {
  * Class members
  */
 
-#if TIME_VEC_WIDTH > 1
+#if defined(TATUM_FIXED_POINT_TIME)
+    /*
+     * Fixed-point
+     */
+    inline Time::tick_type Time::to_ticks(const double time) {
+        if (std::isnan(time)) return INVALID_TICKS;
+        if (std::isinf(time)) return (time < 0.) ? NEG_INF_TICKS : POS_INF_TICKS;
+
+        //Saturate times outside the representable range to infinity
+        double ticks = std::round(time / TATUM_FIXED_POINT_TIME_RESOLUTION);
+        if (ticks >= static_cast<double>(POS_INF_TICKS)) return POS_INF_TICKS;
+        if (ticks <= static_cast<double>(NEG_INF_TICKS)) return NEG_INF_TICKS;
+
+        return static_cast<tick_type>(ticks);
+    }
+
+    inline Time::tick_type Time::add_ticks(const tick_type lhs, const tick_type rhs) {
+        if (is_finite(lhs) && is_finite(rhs)) {
+            return lhs + rhs;
+        }
+
+        //At least one sentinel
+        if (lhs == INVALID_TICKS || rhs == INVALID_TICKS) return INVALID_TICKS;
+        if (!is_finite(lhs) && !is_finite(rhs) && lhs != rhs) return INVALID_TICKS; //inf - inf
+        return is_finite(lhs) ? rhs : lhs; //The infinity
+    }
+
+    inline Time::scalar_type Time::value() const { 
+        if (time_ == INVALID_TICKS) return std::numeric_limits<scalar_type>::quiet_NaN();
+        if (time_ == NEG_INF_TICKS) return -std::numeric_limits<scalar_type>::infinity();
+        if (time_ == POS_INF_TICKS) return std::numeric_limits<scalar_type>::infinity();
+
+        return static_cast<scalar_type>(time_ * TATUM_FIXED_POINT_TIME_RESOLUTION);
+    }
+    inline Time::scalar_type Time::value(size_t /*corner*/) const { return value(); }
+    inline Time::scalar_type Time::min_value() const { return value(); }
+    inline Time::scalar_type Time::max_value() const { return value(); }
+    inline void Time::set_value(scalar_type time) { time_ = to_ticks(time); }
+    inline void Time::set_value(size_t /*corner*/, scalar_type time) { set_value(time); }
+    inline bool Time::valid() const { return time_ != INVALID_TICKS; }
+
+    //Note that since INVALID_TICKS is the smallest value, it only needs special handling
+    //when it would otherwise compare less than (so the result matches NaN comparisons)
+    inline void Time::max(const Time& other) { time_ = (time_ < other.time_ && time_ != INVALID_TICKS) ? other.time_ : time_; }
+    inline void Time::min(const Time& other) { time_ = (other.time_ < time_ && other.time_ != INVALID_TICKS) ? other.time_ : time_; }
+    inline Time& Time::operator+=(const Time& rhs) { time_ = add_ticks(time_, rhs.time_); return *this; }
+    inline Time& Time::operator-=(const Time& rhs) { time_ = add_ticks(time_, (-rhs).time_); return *this; }
+    inline Time& Time::operator*=(const scalar_type factor) {
+        if (time_ == INVALID_TICKS) return *this;
+
+        if (std::isnan(factor)) {
+            time_ = INVALID_TICKS;
+        } else if (is_finite(time_)) {
+            //Round to the nearest tick, saturating to infinity (as in to_ticks())
+            double ticks = std::round(static_cast<double>(time_) * factor);
+            if (ticks >= static_cast<double>(POS_INF_TICKS)) {
+                time_ = POS_INF_TICKS;
+            } else if (ticks <= static_cast<double>(NEG_INF_TICKS)) {
+                time_ = NEG_INF_TICKS;
+            } else {
+                time_ = static_cast<tick_type>(ticks);
+            }
+        } else if (factor == 0.) {
+            time_ = INVALID_TICKS; //inf * 0
+        } else if (factor < 0.) {
+            time_ = (time_ == POS_INF_TICKS) ? NEG_INF_TICKS : POS_INF_TICKS;
+        }
+        return *this;
+    }
+
+#elif TIME_VEC_WIDTH > 1
     /*
      * Serial / inferred SIMD
      */
@@ -19,17 +89,23 @@ namespace tatum {
         }
     }
 
+    inline void Time::set_value(size_t corner, scalar_type time) {
+        time_[corner] = time;
+    }
+
     inline void Time::max(const Time& other)  {
         for(size_t i = 0; i < time_.size(); i++) {
             //Use conditional so compiler will vectorize
-            time_[i] = (time_[i] > other.time_[i]) ? time_[i] : other.time_[i];
+            //(ordered as std::max() so NaN handling matches the scalar case)
+            time_[i] = (time_[i] < other.time_[i]) ? other.time_[i] : time_[i];
         }
     }
 
     inline void Time::min(const Time& other)  {
         for(size_t i = 0; i < time_.size(); i++) {
             //Use conditional so compiler will vectorize
-            time_[i] = (time_[i] < other.time_[i]) ? time_[i] : other.time_[i];
+            //(ordered as std::min() so NaN handling matches the scalar case)
+            time_[i] = (other.time_[i] < time_[i]) ? other.time_[i] : time_[i];
         }
     }
 
@@ -49,7 +125,34 @@ namespace tatum {
         return *this;
     }
 
+    inline Time& Time::operator*=(const scalar_type factor) {
+        for(size_t i = 0; i < time_.size(); i++) {
+            time_[i] *= factor;
+        }
+
+        return *this;
+    }
+
     inline Time::scalar_type Time::value() const { return time_[0]; }
+    inline Time::scalar_type Time::value(size_t corner) const { return time_[corner]; }
+
+    inline Time::scalar_type Time::min_value() const {
+        scalar_type result = time_[0];
+        for(size_t i = 1; i < time_.size(); i++) {
+            if(std::isnan(time_[i])) return time_[i];
+            result = std::min(result, time_[i]);
+        }
+        return result;
+    }
+
+    inline Time::scalar_type Time::max_value() const {
+        scalar_type result = time_[0];
+        for(size_t i = 1; i < time_.size(); i++) {
+            if(std::isnan(time_[i])) return time_[i];
+            result = std::max(result, time_[i]);
+        }
+        return result;
+    }
 
     inline bool Time::valid() const {
         //This is a reduction with a function call inside,
@@ -62,13 +165,18 @@ namespace tatum {
     }
 #else //Scalar case (TIME_VEC_WIDTH == 1)
     inline Time::scalar_type Time::value() const { return time_; }
+    inline Time::scalar_type Time::value(size_t /*corner*/) const { return time_; }
+    inline Time::scalar_type Time::min_value() const { return time_; }
+    inline Time::scalar_type Time::max_value() const { return time_; }
     inline void Time::set_value(scalar_type time) { time_ = time; }
+    inline void Time::set_value(size_t /*corner*/, scalar_type time) { time_ = time; }
     inline bool Time::valid() const { return !std::isnan(time_); }
 
     inline void Time::max(const Time& other) { time_ = std::max(time_, other.time_); }
     inline void Time::min(const Time& other) { time_ = std::min(time_, other.time_); }
     inline Time& Time::operator+=(const Time& rhs) { time_ += rhs.time_; return *this; }
     inline Time& Time::operator-=(const Time& rhs) { time_ -= rhs.time_; return *this; }
+    inline Time& Time::operator*=(const scalar_type factor) { time_ *= factor; return *this; }
 
 #endif //TIME_VEC_WIDTH
 
@@ -76,17 +184,66 @@ namespace tatum {
  * External functions
  */
 
-#if TIME_VEC_WIDTH > 1
+#if defined(TATUM_FIXED_POINT_TIME)
+inline bool operator==(const Time lhs, const Time rhs) {
+    return lhs.time_ == rhs.time_ && lhs.time_ != Time::INVALID_TICKS;
+}
+
+inline bool operator<(const Time lhs, const Time rhs) {
+    return lhs.time_ < rhs.time_ && lhs.time_ != Time::INVALID_TICKS;
+}
+
+inline bool operator>(const Time lhs, const Time rhs) {
+    return lhs.time_ > rhs.time_ && rhs.time_ != Time::INVALID_TICKS;
+}
+
 inline Time operator-(Time in) {
-    for(size_t i = 0; i < time_.size(); i++) {
-        in.time_[i] = -in.time_[i];
+    if (in.time_ == Time::NEG_INF_TICKS) {
+        in.time_ = Time::POS_INF_TICKS;
+    } else if (in.time_ == Time::POS_INF_TICKS) {
+        in.time_ = Time::NEG_INF_TICKS;
+    } else if (in.time_ != Time::INVALID_TICKS) {
+        in.time_ = -in.time_;
     }
     return in;
 }
 inline Time operator+(Time in) {
-    for(size_t i = 0; i < time_.size(); i++) {
-        in.time_[i] = +in.time_[i];
+    return in;
+}
+#elif TIME_VEC_WIDTH > 1
+//Comparisons hold only if they hold for every corner
+
+inline bool operator==(const Time lhs, const Time rhs) {
+    bool result = true;
+    for(size_t i = 0; i < lhs.time_.size(); i++) {
+        result &= (lhs.time_[i] == rhs.time_[i]);
+    }
+    return result;
+}
+
+inline bool operator<(const Time lhs, const Time rhs) {
+    bool result = true;
+    for(size_t i = 0; i < lhs.time_.size(); i++) {
+        result &= (lhs.time_[i] < rhs.time_[i]);
+    }
+    return result;
+}
+
+inline bool operator>(const Time lhs, const Time rhs) {
+    bool result = true;
+    for(size_t i = 0; i < lhs.time_.size(); i++) {
+        result &= (lhs.time_[i] > rhs.time_[i]);
     }
+    return result;
+}
+
+inline Time operator-(Time in) {
+    for(size_t i = 0; i < in.time_.size(); i++) {
+        in.time_[i] = -in.time_[i];
+    }
+    return in;
+}
+inline Time operator+(Time in) {
     return in;
 }
 #else //Scalar case (TIME_VEC_WIDTH == 1)
@@ -112,6 +269,10 @@ inline Time operator+(Time in) {
 }
 #endif //TIME_VEC_WIDTH
 
+inline bool operator!=(const Time lhs, const Time rhs) {
+    return !(lhs == rhs);
+}
+
 inline Time operator+(Time lhs, const Time& rhs) {
     return lhs += rhs;
 }
@@ -120,6 +281,10 @@ inline Time operator-(Time lhs, const Time& rhs) {
     return lhs -= rhs;
 }
 
+inline Time operator*(Time lhs, const Time::scalar_type factor) {
+    return lhs *= factor;
+}
+
 inline std::ostream& operator<<(std::ostream& os, const Time& time) {
     os << time.value();
     return os;
@@ -1,8 +1,12 @@
+#include <algorithm>
 #include <iostream>
 #include <limits>
+#include <string>
 
 #include "tatum/util/tatum_assert.hpp"
 #include "tatum/TimingConstraints.hpp"
+#include "tatum/tags/TimingTag.hpp"
+#include "tatum/error.hpp"
 
 using std::cout;
 using std::endl;
@@ -30,9 +34,10 @@ bool TimingConstraints::is_virtual_clock(const DomainId id) const {
 }
 
 DomainId TimingConstraints::node_clock_domain(const NodeId id) const {
-    //This is currenlty a linear search through all clock sources and
-    //I/O constraints, could be made more efficient but it is only called
-    //rarely (i.e. during pre-traversals)
+    if (frozen_) {
+        if (size_t(id) >= node_clock_domains_.size()) return DomainId::INVALID();
+        return node_clock_domains_[id];
+    }
 
     //Is it a clock source?
     DomainId source_domain = find_node_source_clock_domain(id);
@@ -40,24 +45,16 @@ DomainId TimingConstraints::node_clock_domain(const NodeId id) const {
 
     //Does it have an input constarint?
     for(DelayType delay_type : {DelayType::MAX, DelayType::MIN}) {
-        for(auto kv : input_constraints(delay_type)) {
-            auto node_id = kv.first;
-            auto domain_id = kv.second.domain;
-
-            //TODO: Assumes a single clock per node
-            if(node_id == id) return domain_id;
-        }
+        //TODO: Assumes a single clock per node
+        auto constraints = input_constraints(id, delay_type);
+        if(!constraints.empty()) return constraints.begin()->second.domain;
     }
 
     //Does it have an output constraint?
     for(DelayType delay_type : {DelayType::MAX, DelayType::MIN}) {
-        for(auto kv : output_constraints(delay_type)) {
-            auto node_id = kv.first;
-            auto domain_id = kv.second.domain;
-
-            //TODO: Assumes a single clock per node
-            if(node_id == id) return domain_id;
-        }
+        //TODO: Assumes a single clock per node
+        auto constraints = output_constraints(id, delay_type);
+        if(!constraints.empty()) return constraints.begin()->second.domain;
     }
 
     //None found
@@ -65,11 +62,19 @@ DomainId TimingConstraints::node_clock_domain(const NodeId id) const {
 }
 
 bool TimingConstraints::node_is_clock_source(const NodeId id) const {
+    if (frozen_) {
+        return size_t(id) < clock_source_nodes_.size() && clock_source_nodes_[size_t(id)];
+    }
+
     //Returns a DomainId which converts to true if valid
     return bool(find_node_source_clock_domain(id));
 }
 
 bool TimingConstraints::node_is_constant_generator(const NodeId id) const {
+    if (frozen_) {
+        return size_t(id) < constant_generator_nodes_.size() && constant_generator_nodes_[size_t(id)];
+    }
+
     return constant_generators_.count(id);
 }
 
@@ -97,18 +102,58 @@ DomainId TimingConstraints::find_clock_domain(const std::string& name) const {
     return DomainId::INVALID();
 }
 
+bool TimingConstraints::frozen() const {
+    return frozen_;
+}
+
+TimingConstraints::domain_pair_range TimingConstraints::domain_pairs() const {
+    TATUM_ASSERT(frozen_);
+    return tatum::util::make_range(domain_pair_ids_.begin(), domain_pair_ids_.end());
+}
+
+DomainPairId TimingConstraints::domain_pair_id(const DomainId src_domain, const DomainId sink_domain) const {
+    TATUM_ASSERT(frozen_);
+    return domain_pair_matrix_[domain_pair_matrix_index(src_domain, sink_domain)];
+}
+
+DomainId TimingConstraints::domain_pair_src_domain(const DomainPairId id) const {
+    TATUM_ASSERT(frozen_);
+    return domain_pair_src_domains_[id];
+}
+
+DomainId TimingConstraints::domain_pair_sink_domain(const DomainPairId id) const {
+    TATUM_ASSERT(frozen_);
+    return domain_pair_sink_domains_[id];
+}
+
 bool TimingConstraints::should_analyze(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node) const {
     TATUM_ASSERT(src_domain);
     TATUM_ASSERT(sink_domain);
 
+    if (frozen_) {
+        DomainPairId domain_pair = domain_pair_id(src_domain, sink_domain);
+        if (!domain_pair) return false; //No constraints between the domains
+
+        if (domain_pair_has_default_constraint_[domain_pair]) return true;
+
+        //Only constrained at specific capture nodes
+        return capture_node && find_capture_node_constraint(domain_pair, capture_node);
+    }
+
     //If there is a domain pair + capture node or domain pair constraint then it should be analyzed
-    return setup_constraints_.count(NodeDomainPair(src_domain, sink_domain, capture_node)) 
-           || setup_constraints_.count(NodeDomainPair(src_domain, sink_domain, NodeId::INVALID())) 
-           || hold_constraints_.count(NodeDomainPair(src_domain, sink_domain, capture_node))
-           || hold_constraints_.count(NodeDomainPair(src_domain, sink_domain, NodeId::INVALID()));
+    return has_constraint(src_domain, sink_domain, capture_node)
+           || has_constraint(src_domain, sink_domain, NodeId::INVALID());
 }
 
 Time TimingConstraints::hold_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node) const {
+    if (frozen_) {
+        if (capture_node) {
+            const CaptureNodeConstraint* node_constraint = find_capture_node_constraint(domain_pair_id(src_domain, sink_domain), capture_node);
+            if (node_constraint) return node_constraint->hold_constraint;
+        }
+        return hold_constraint_matrix_[domain_pair_matrix_index(src_domain, sink_domain)];
+    }
+
     //Try to find the capture node-specific constraint
     auto iter = hold_constraints_.find(NodeDomainPair(src_domain, sink_domain, capture_node));
     if(iter != hold_constraints_.end()) {
@@ -126,6 +171,14 @@ Time TimingConstraints::hold_constraint(const DomainId src_domain, const DomainI
 }
 
 Time TimingConstraints::setup_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node) const {
+    if (frozen_) {
+        if (capture_node) {
+            const CaptureNodeConstraint* node_constraint = find_capture_node_constraint(domain_pair_id(src_domain, sink_domain), capture_node);
+            if (node_constraint) return node_constraint->setup_constraint;
+        }
+        return setup_constraint_matrix_[domain_pair_matrix_index(src_domain, sink_domain)];
+    }
+
     //Try to find the capture node-specific constraint
     auto iter = setup_constraints_.find(NodeDomainPair(src_domain, sink_domain, capture_node));
     if(iter != setup_constraints_.end()) {
@@ -143,6 +196,9 @@ Time TimingConstraints::setup_constraint(const DomainId src_domain, const Domain
 }
 
 Time TimingConstraints::setup_clock_uncertainty(const DomainId src_domain, const DomainId sink_domain) const {
+    if (frozen_) {
+        return setup_clock_uncertainty_matrix_[domain_pair_matrix_index(src_domain, sink_domain)];
+    }
 
     auto iter = setup_clock_uncertainties_.find(DomainPair(src_domain, sink_domain));
     if(iter == setup_clock_uncertainties_.end()) {
@@ -153,6 +209,9 @@ Time TimingConstraints::setup_clock_uncertainty(const DomainId src_domain, const
 }
 
 Time TimingConstraints::hold_clock_uncertainty(const DomainId src_domain, const DomainId sink_domain) const {
+    if (frozen_) {
+        return hold_clock_uncertainty_matrix_[domain_pair_matrix_index(src_domain, sink_domain)];
+    }
 
     auto iter = hold_clock_uncertainties_.find(DomainPair(src_domain, sink_domain));
     if(iter == hold_clock_uncertainties_.end()) {
@@ -163,6 +222,12 @@ Time TimingConstraints::hold_clock_uncertainty(const DomainId src_domain, const
 }
 
 Time TimingConstraints::input_constraint(const NodeId node_id, const DomainId domain_id, const DelayType delay_type) const {
+    if (frozen_) {
+        const IoConstraint* io_constraint = find_node_io_constraint((delay_type == DelayType::MAX) ? max_node_input_constraints_ : min_node_input_constraints_,
+                                                                    node_id, domain_id);
+        if (io_constraint) return io_constraint->constraint;
+        return std::numeric_limits<Time>::quiet_NaN();
+    }
 
     if (delay_type == DelayType::MAX) {
         auto iter = find_io_constraint(node_id, domain_id, max_input_constraints_);
@@ -181,6 +246,12 @@ Time TimingConstraints::input_constraint(const NodeId node_id, const DomainId do
 }
 
 Time TimingConstraints::output_constraint(const NodeId node_id, const DomainId domain_id, const DelayType delay_type) const {
+    if (frozen_) {
+        const IoConstraint* io_constraint = find_node_io_constraint((delay_type == DelayType::MAX) ? max_node_output_constraints_ : min_node_output_constraints_,
+                                                                    node_id, domain_id);
+        if (io_constraint) return io_constraint->constraint;
+        return std::numeric_limits<Time>::quiet_NaN();
+    }
 
     if (delay_type == DelayType::MAX) {
         auto iter = find_io_constraint(node_id, domain_id, max_output_constraints_);
@@ -199,6 +270,14 @@ Time TimingConstraints::output_constraint(const NodeId node_id, const DomainId d
 }
 
 Time TimingConstraints::source_latency(const DomainId domain, const ArrivalType arrival_type) const {
+    if (frozen_) {
+        if (arrival_type == ArrivalType::EARLY) {
+            return early_source_latency_table_[domain];
+        } else {
+            TATUM_ASSERT(arrival_type == ArrivalType::LATE);
+            return late_source_latency_table_[domain];
+        }
+    }
 
     if (arrival_type == ArrivalType::EARLY) {
         auto iter = source_latencies_early_.find(domain);
@@ -289,6 +368,12 @@ TimingConstraints::source_latency_range TimingConstraints::source_latencies(Arri
 DomainId TimingConstraints::create_clock_domain(const std::string name) { 
     DomainId id = find_clock_domain(name);
     if(!id) {
+        unfreeze();
+
+        if (domain_ids_.size() >= TimingTag::MAX_CLOCK_DOMAINS) {
+            throw tatum::Error("Too many clock domains (at most " + std::to_string(TimingTag::MAX_CLOCK_DOMAINS) + " are supported)");
+        }
+
         //Create it
         id = DomainId(domain_ids_.size()); 
         domain_ids_.push_back(id); 
@@ -307,6 +392,7 @@ void TimingConstraints::set_setup_constraint(const DomainId src_domain, const Do
     set_setup_constraint(src_domain, sink_domain, NodeId::INVALID(), constraint);
 }
 void TimingConstraints::set_setup_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node, const Time constraint) {
+    unfreeze();
     auto key = NodeDomainPair(src_domain, sink_domain, capture_node);
     setup_constraints_[key] = constraint;
 }
@@ -316,21 +402,25 @@ void TimingConstraints::set_hold_constraint(const DomainId src_domain, const Dom
 }
 
 void TimingConstraints::set_hold_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node, const Time constraint) {
+    unfreeze();
     auto key = NodeDomainPair(src_domain, sink_domain, capture_node);
     hold_constraints_[key] = constraint;
 }
 
 void TimingConstraints::set_setup_clock_uncertainty(const DomainId src_domain, const DomainId sink_domain, const Time uncertainty) {
+    unfreeze();
     auto key = DomainPair(src_domain, sink_domain);
     setup_clock_uncertainties_[key] = uncertainty;
 }
 
 void TimingConstraints::set_hold_clock_uncertainty(const DomainId src_domain, const DomainId sink_domain, const Time uncertainty) {
+    unfreeze();
     auto key = DomainPair(src_domain, sink_domain);
     hold_clock_uncertainties_[key] = uncertainty;
 }
 
 void TimingConstraints::set_input_constraint(const NodeId node_id, const DomainId domain_id, const DelayType delay_type, const Time constraint) {
+    unfreeze();
     if (delay_type == DelayType::MAX) {
         auto iter = find_io_constraint(node_id, domain_id, max_input_constraints_);
         if(iter != max_input_constraints_.end()) {
@@ -354,6 +444,7 @@ void TimingConstraints::set_input_constraint(const NodeId node_id, const DomainI
 }
 
 void TimingConstraints::set_output_constraint(const NodeId node_id, const DomainId domain_id, const DelayType delay_type, const Time constraint) {
+    unfreeze();
     if (delay_type == DelayType::MAX) {
         auto iter = find_io_constraint(node_id, domain_id, max_output_constraints_);
         if(iter != max_output_constraints_.end()) {
@@ -377,6 +468,7 @@ void TimingConstraints::set_output_constraint(const NodeId node_id, const Domain
 }
 
 void TimingConstraints::set_source_latency(const DomainId domain, const ArrivalType arrival_type, const Time latency) {
+    unfreeze();
     if (arrival_type == ArrivalType::EARLY) {
         source_latencies_early_[domain] = latency;
     } else {
@@ -386,10 +478,12 @@ void TimingConstraints::set_source_latency(const DomainId domain, const ArrivalT
 }
 
 void TimingConstraints::set_clock_domain_source(const NodeId node_id, const DomainId domain_id) {
+    unfreeze();
     domain_sources_[domain_id] = node_id;
 }
 
 void TimingConstraints::set_constant_generator(const NodeId node_id, bool is_constant_generator) {
+    unfreeze();
     if(is_constant_generator) {
         constant_generators_.insert(node_id);
     } else {
@@ -398,6 +492,7 @@ void TimingConstraints::set_constant_generator(const NodeId node_id, bool is_con
 }
 
 void TimingConstraints::remap_nodes(const tatum::util::linear_map<NodeId,NodeId>& node_map) {
+    unfreeze();
 
     //Domain Sources
     tatum::util::linear_map<DomainId,NodeId> remapped_domain_sources(domain_sources_.size());
@@ -455,6 +550,166 @@ void TimingConstraints::remap_nodes(const tatum::util::linear_map<NodeId,NodeId>
     min_output_constraints_ = std::move(remapped_min_output_constraints);
 }
 
+void TimingConstraints::freeze() {
+    unfreeze();
+
+    size_t num_domains = domain_ids_.size();
+
+    //Record which domain pairs have setup/hold constraints
+    enum class PairConstraint : char {
+        NONE,
+        CAPTURE_NODE, //Only capture node specific constraints
+        DEFAULT //A default constraint
+    };
+    std::vector<PairConstraint> pair_constraints(num_domains * num_domains, PairConstraint::NONE);
+    for (const auto* constraints : {&setup_constraints_, &hold_constraints_}) {
+        for (const auto& kv : *constraints) {
+            const NodeDomainPair& key = kv.first;
+
+            PairConstraint& pair_constraint = pair_constraints[domain_pair_matrix_index(key.domain_pair.src_domain_id, key.domain_pair.sink_domain_id)];
+            if (!key.capture_node) {
+                pair_constraint = PairConstraint::DEFAULT;
+            } else if (pair_constraint == PairConstraint::NONE) {
+                pair_constraint = PairConstraint::CAPTURE_NODE;
+            }
+        }
+    }
+
+    //Number the constrained domain pairs densely
+    domain_pair_matrix_.resize(num_domains * num_domains, DomainPairId::INVALID());
+    for (DomainId src_domain : domain_ids_) {
+        for (DomainId sink_domain : domain_ids_) {
+            size_t index = domain_pair_matrix_index(src_domain, sink_domain);
+            if (pair_constraints[index] == PairConstraint::NONE) continue;
+
+            DomainPairId id(domain_pair_ids_.size());
+            domain_pair_ids_.push_back(id);
+            domain_pair_src_domains_.push_back(src_domain);
+            domain_pair_sink_domains_.push_back(sink_domain);
+            domain_pair_has_default_constraint_.push_back(pair_constraints[index] == PairConstraint::DEFAULT);
+
+            domain_pair_matrix_[index] = id;
+        }
+    }
+
+    //Default constraints and clock uncertainties
+    setup_constraint_matrix_.resize(num_domains * num_domains, std::numeric_limits<Time>::quiet_NaN());
+    hold_constraint_matrix_.resize(num_domains * num_domains, std::numeric_limits<Time>::quiet_NaN());
+    for (const auto& kv : setup_constraints_) {
+        if (kv.first.capture_node) continue;
+        setup_constraint_matrix_[domain_pair_matrix_index(kv.first.domain_pair.src_domain_id, kv.first.domain_pair.sink_domain_id)] = kv.second;
+    }
+    for (const auto& kv : hold_constraints_) {
+        if (kv.first.capture_node) continue;
+        hold_constraint_matrix_[domain_pair_matrix_index(kv.first.domain_pair.src_domain_id, kv.first.domain_pair.sink_domain_id)] = kv.second;
+    }
+
+    setup_clock_uncertainty_matrix_.resize(num_domains * num_domains, Time(0.));
+    hold_clock_uncertainty_matrix_.resize(num_domains * num_domains, Time(0.));
+    for (const auto& kv : setup_clock_uncertainties_) {
+        setup_clock_uncertainty_matrix_[domain_pair_matrix_index(kv.first.src_domain_id, kv.first.sink_domain_id)] = kv.second;
+    }
+    for (const auto& kv : hold_clock_uncertainties_) {
+        hold_clock_uncertainty_matrix_[domain_pair_matrix_index(kv.first.src_domain_id, kv.first.sink_domain_id)] = kv.second;
+    }
+
+    //Source latencies
+    early_source_latency_table_.resize(num_domains, Time(0.));
+    late_source_latency_table_.resize(num_domains, Time(0.));
+    for (const auto& kv : source_latencies_early_) {
+        early_source_latency_table_[kv.first] = kv.second;
+    }
+    for (const auto& kv : source_latencies_late_) {
+        late_source_latency_table_[kv.first] = kv.second;
+    }
+
+    //Capture node specific constraints, merging the setup and hold constraints of each
+    //capture node and domain pair (the constraint maps are ordered by capture node)
+    std::map<std::pair<NodeId,DomainPairId>,CaptureNodeConstraint> node_constraints;
+    auto find_or_create_node_constraint = [&](const NodeDomainPair& key) -> CaptureNodeConstraint& {
+        size_t index = domain_pair_matrix_index(key.domain_pair.src_domain_id, key.domain_pair.sink_domain_id);
+        DomainPairId domain_pair = domain_pair_matrix_[index];
+        TATUM_ASSERT(domain_pair);
+
+        auto result = node_constraints.insert(std::make_pair(std::make_pair(key.capture_node, domain_pair), CaptureNodeConstraint()));
+        CaptureNodeConstraint& node_constraint = result.first->second;
+        if (result.second) {
+            //New, initialize to the domain pair's defaults
+            node_constraint.domain_pair = domain_pair;
+            node_constraint.setup_constraint = setup_constraint_matrix_[index];
+            node_constraint.hold_constraint = hold_constraint_matrix_[index];
+        }
+        return node_constraint;
+    };
+    for (const auto& kv : setup_constraints_) {
+        if (!kv.first.capture_node) continue;
+        find_or_create_node_constraint(kv.first).setup_constraint = kv.second;
+    }
+    for (const auto& kv : hold_constraints_) {
+        if (!kv.first.capture_node) continue;
+        find_or_create_node_constraint(kv.first).hold_constraint = kv.second;
+    }
+
+    if (!node_constraints.empty()) {
+        size_t num_nodes = size_t(node_constraints.rbegin()->first.first) + 1;
+        capture_node_constraints_begin_.resize(num_nodes + 1, 0);
+        for (const auto& kv : node_constraints) {
+            ++capture_node_constraints_begin_[size_t(kv.first.first) + 1];
+            capture_node_constraints_.push_back(kv.second);
+        }
+        for (size_t inode = 0; inode < num_nodes; ++inode) {
+            capture_node_constraints_begin_[inode + 1] += capture_node_constraints_begin_[inode];
+        }
+        TATUM_ASSERT(capture_node_constraints_begin_.back() == capture_node_constraints_.size());
+    }
+
+    //Per-node tables, covering every node referenced by the constraints
+    size_t num_nodes = 0;
+    for (NodeId node_id : domain_sources_) {
+        if (node_id) num_nodes = std::max(num_nodes, size_t(node_id) + 1);
+    }
+    for (NodeId node_id : constant_generators_) {
+        num_nodes = std::max(num_nodes, size_t(node_id) + 1);
+    }
+    for (const auto* io_constraints : {&max_input_constraints_, &min_input_constraints_, &max_output_constraints_, &min_output_constraints_}) {
+        if (!io_constraints->empty()) num_nodes = std::max(num_nodes, size_t(io_constraints->rbegin()->first) + 1);
+    }
+
+    constant_generator_nodes_.resize(num_nodes, false);
+    for (NodeId node_id : constant_generators_) {
+        constant_generator_nodes_[size_t(node_id)] = true;
+    }
+
+    build_node_io_constraints(max_input_constraints_, num_nodes, max_node_input_constraints_);
+    build_node_io_constraints(min_input_constraints_, num_nodes, min_node_input_constraints_);
+    build_node_io_constraints(max_output_constraints_, num_nodes, max_node_output_constraints_);
+    build_node_io_constraints(min_output_constraints_, num_nodes, min_node_output_constraints_);
+
+    //A node's clock domain is that of its clock source, or failing that its first input
+    //(then output) constraint, as for an un-frozen node_clock_domain()
+    clock_source_nodes_.resize(num_nodes, false);
+    node_clock_domains_.resize(num_nodes, DomainId::INVALID());
+    for (size_t inode = 0; inode < num_nodes; ++inode) {
+        for (const NodeIoConstraints* node_io_constraints : {&max_node_input_constraints_, &min_node_input_constraints_,
+                                                             &max_node_output_constraints_, &min_node_output_constraints_}) {
+            size_t begin = node_io_constraints->begin[inode];
+            if (begin != node_io_constraints->begin[inode + 1]) {
+                node_clock_domains_[NodeId(inode)] = node_io_constraints->constraints[begin].domain;
+                break;
+            }
+        }
+    }
+    for (auto iter = domain_ids_.rbegin(); iter != domain_ids_.rend(); ++iter) { //Lowest id takes precedence
+        NodeId source_node = domain_sources_[*iter];
+        if (!source_node) continue;
+
+        clock_source_nodes_[size_t(source_node)] = true;
+        node_clock_domains_[source_node] = *iter;
+    }
+
+    frozen_ = true;
+}
+
 void TimingConstraints::print_constraints() const {
     cout << "Setup Clock Constraints" << endl;
     for(auto kv : setup_constraints()) {
@@ -548,6 +803,90 @@ void TimingConstraints::print_constraints() const {
     }
 }
 
+bool TimingConstraints::has_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node) const {
+    return setup_constraints_.count(NodeDomainPair(src_domain, sink_domain, capture_node))
+           || hold_constraints_.count(NodeDomainPair(src_domain, sink_domain, capture_node));
+}
+
+void TimingConstraints::unfreeze() {
+    frozen_ = false;
+
+    domain_pair_matrix_.clear();
+    domain_pair_ids_.clear();
+    domain_pair_src_domains_.clear();
+    domain_pair_sink_domains_.clear();
+    domain_pair_has_default_constraint_.clear();
+
+    setup_constraint_matrix_.clear();
+    hold_constraint_matrix_.clear();
+    setup_clock_uncertainty_matrix_.clear();
+    hold_clock_uncertainty_matrix_.clear();
+
+    early_source_latency_table_.clear();
+    late_source_latency_table_.clear();
+
+    capture_node_constraints_begin_.clear();
+    capture_node_constraints_.clear();
+
+    constant_generator_nodes_.clear();
+    clock_source_nodes_.clear();
+    node_clock_domains_.clear();
+
+    for (NodeIoConstraints* node_io_constraints : {&max_node_input_constraints_, &min_node_input_constraints_,
+                                                   &max_node_output_constraints_, &min_node_output_constraints_}) {
+        node_io_constraints->begin.clear();
+        node_io_constraints->constraints.clear();
+    }
+}
+
+size_t TimingConstraints::domain_pair_matrix_index(const DomainId src_domain, const DomainId sink_domain) const {
+    TATUM_ASSERT_SAFE(size_t(src_domain) < domain_ids_.size());
+    TATUM_ASSERT_SAFE(size_t(sink_domain) < domain_ids_.size());
+    return size_t(src_domain) * domain_ids_.size() + size_t(sink_domain);
+}
+
+void TimingConstraints::build_node_io_constraints(const std::multimap<NodeId,IoConstraint>& io_constraints, const size_t num_nodes, NodeIoConstraints& node_io_constraints) {
+    node_io_constraints.begin.assign(num_nodes + 1, 0);
+    node_io_constraints.constraints.clear();
+    node_io_constraints.constraints.reserve(io_constraints.size());
+
+    //The multimap is ordered by node, so each node's constraints are already contiguous
+    for (const auto& kv : io_constraints) {
+        ++node_io_constraints.begin[size_t(kv.first) + 1];
+        node_io_constraints.constraints.push_back(kv.second);
+    }
+    for (size_t inode = 0; inode < num_nodes; ++inode) {
+        node_io_constraints.begin[inode + 1] += node_io_constraints.begin[inode];
+    }
+    TATUM_ASSERT(node_io_constraints.begin.back() == node_io_constraints.constraints.size());
+}
+
+const IoConstraint* TimingConstraints::find_node_io_constraint(const NodeIoConstraints& node_io_constraints, const NodeId node_id, const DomainId domain_id) {
+    size_t inode = size_t(node_id);
+    if (inode + 1 >= node_io_constraints.begin.size()) return nullptr; //No I/O constraints
+
+    for (size_t i = node_io_constraints.begin[inode]; i < node_io_constraints.begin[inode + 1]; ++i) {
+        if (node_io_constraints.constraints[i].domain == domain_id) return &node_io_constraints.constraints[i];
+    }
+
+    //Not found
+    return nullptr;
+}
+
+const CaptureNodeConstraint* TimingConstraints::find_capture_node_constraint(const DomainPairId domain_pair, const NodeId capture_node) const {
+    TATUM_ASSERT_SAFE(frozen_);
+    size_t inode = size_t(capture_node);
+    if (inode + 1 >= capture_node_constraints_begin_.size()) return nullptr; //No capture node specific constraints
+
+    //Few domain pairs are expected to be constrained at any one capture node, so a linear search suffices
+    for (size_t i = capture_node_constraints_begin_[inode]; i < capture_node_constraints_begin_[inode + 1]; ++i) {
+        if (capture_node_constraints_[i].domain_pair == domain_pair) return &capture_node_constraints_[i];
+    }
+
+    //Not found
+    return nullptr;
+}
+
 TimingConstraints::io_constraint_iterator TimingConstraints::find_io_constraint(const NodeId node_id, const DomainId domain_id, const std::multimap<NodeId,IoConstraint>& io_constraints) const {
     auto range = io_constraints.equal_range(node_id);
     for(auto iter = range.first; iter != range.second; ++iter) {
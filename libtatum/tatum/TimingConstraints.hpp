@@ -5,6 +5,7 @@
 
 #include "tatum/util/tatum_linear_map.hpp"
 #include "tatum/util/tatum_range.hpp"
+#include "tatum/util/tatum_aligned_alloc.hpp"
 
 #include "tatum/base/ArrivalType.hpp"
 #include "tatum/base/DelayType.hpp"
@@ -18,10 +19,21 @@ namespace tatum {
 
 /**
  * The TimingConstraints class stores all the timing constraints applied during timing analysis.
+ *
+ * Once all constraints have been specified they must be frozen (see freeze()) before
+ * analysis. This numbers the analyzed clock domain pairs densely (the ids are recorded in
+ * the required and slack tags, see TimingTag::domain_pair()) and allows the queries made during
+ * analysis to be answered without map look-ups: the default constraints, clock
+ * uncertainties and source latencies are compiled into dense tables indexed by
+ * domain (pair), and capture node specific constraints into a compact table indexed
+ * by capture node. The per-node queries made when initializing startpoints and endpoints
+ * (e.g. node_is_clock_source(), node_clock_domain(), input_constraint()) are likewise
+ * answered from node-indexed tables.
  */
 class TimingConstraints {
     public: //Types
         typedef tatum::util::linear_map<DomainId,DomainId>::const_iterator domain_iterator;
+        typedef tatum::util::linear_map<DomainPairId,DomainPairId>::const_iterator domain_pair_iterator;
         typedef std::map<NodeDomainPair,Time>::const_iterator clock_constraint_iterator;
         typedef std::map<DomainPair,Time>::const_iterator clock_uncertainty_iterator;
         typedef std::multimap<NodeId,IoConstraint>::const_iterator io_constraint_iterator;
@@ -29,6 +41,7 @@ class TimingConstraints {
         typedef std::unordered_set<NodeId>::const_iterator constant_generator_iterator;
 
         typedef tatum::util::Range<domain_iterator> domain_range;
+        typedef tatum::util::Range<domain_pair_iterator> domain_pair_range;
         typedef tatum::util::Range<clock_constraint_iterator> clock_constraint_range;
         typedef tatum::util::Range<clock_uncertainty_iterator> clock_uncertainty_range;
         typedef tatum::util::Range<io_constraint_iterator> io_constraint_range;
@@ -60,6 +73,22 @@ class TimingConstraints {
         ///\returns A valid DomainId if a clock domain with the specified name exists, DomainId::INVALID() otherwise
         DomainId find_clock_domain(const std::string& name) const;
 
+        ///\returns True if the constraints are frozen (i.e. freeze() has been called since they were last modified)
+        bool frozen() const;
+
+        ///\returns A range containing all analyzed domain pairs (requires frozen constraints)
+        domain_pair_range domain_pairs() const;
+
+        ///\returns The id of the domain pair between src_domain and sink_domain, or DomainPairId::INVALID()
+        ///          if paths between them are never analyzed (requires frozen constraints)
+        DomainPairId domain_pair_id(const DomainId src_domain, const DomainId sink_domain) const;
+
+        ///\returns The source (launch) clock domain of the specified domain pair
+        DomainId domain_pair_src_domain(const DomainPairId id) const;
+
+        ///\returns The sink (capture) clock domain of the specified domain pair
+        DomainId domain_pair_sink_domain(const DomainPairId id) const;
+
         ///Indicates whether the paths between src_domain and sink_domain should be analyzed
         ///\param src_domain The ID of the source (launch) clock domain
         ///\param sink_domain The ID of the sink (capture) clock domain
@@ -157,8 +186,21 @@ class TimingConstraints {
         ///\param node_map A vector mapping from old to new node ids
         void remap_nodes(const tatum::util::linear_map<NodeId,NodeId>& node_map);
 
+        ///Freezes the constraints, building the look-up tables used to speed-up analysis.
+        ///Must be called once all constraints have been specified (analyzers assert the constraints
+        ///are frozen). Any later modification un-freezes the constraints. They should then be re-frozen,
+        ///and new analyzers constructed (since the domain pairs recorded in existing tags may be re-numbered).
+        void freeze();
+
     private:
         typedef std::multimap<NodeId,IoConstraint>::iterator mutable_io_constraint_iterator;
+
+        //The I/O constraints of each node in CSR form: those of node lie in
+        //[begin[node], begin[node+1]) of constraints. Nodes beyond the end of begin have none.
+        struct NodeIoConstraints {
+            std::vector<size_t> begin;
+            std::vector<IoConstraint> constraints;
+        };
     private:
         ///\returns A valid domain id if the node is a clock source
         DomainId find_node_source_clock_domain(const NodeId node_id) const;
@@ -166,6 +208,24 @@ class TimingConstraints {
         io_constraint_iterator find_io_constraint(const NodeId node_id, const DomainId domain_id, const std::multimap<NodeId,IoConstraint>& io_constraints) const;
         mutable_io_constraint_iterator find_io_constraint(const NodeId node_id, const DomainId domain_id, std::multimap<NodeId,IoConstraint>& io_constraints);
 
+        ///\returns True if there is a setup or hold constraint between the domains at capture_node
+        bool has_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node) const;
+
+        ///Invalidates the look-up tables built by freeze()
+        void unfreeze();
+
+        ///\returns The index of the domain pair in domain_pair_matrix_
+        size_t domain_pair_matrix_index(const DomainId src_domain, const DomainId sink_domain) const;
+
+        ///Builds the CSR form of io_constraints, covering nodes [0, num_nodes)
+        static void build_node_io_constraints(const std::multimap<NodeId,IoConstraint>& io_constraints, const size_t num_nodes, NodeIoConstraints& node_io_constraints);
+
+        ///\returns The frozen I/O constraint of node_id in domain_id, or nullptr if there is none
+        static const IoConstraint* find_node_io_constraint(const NodeIoConstraints& node_io_constraints, const NodeId node_id, const DomainId domain_id);
+
+        ///\returns The frozen capture node specific constraints of the domain pair at capture_node,
+        ///          or nullptr if there are none (requires frozen constraints)
+        const CaptureNodeConstraint* find_capture_node_constraint(const DomainPairId domain_pair, const NodeId capture_node) const;
 
     private: //Data
         tatum::util::linear_map<DomainId,DomainId> domain_ids_;
@@ -191,6 +251,49 @@ class TimingConstraints {
 
         std::map<DomainId,Time> source_latencies_early_;
         std::map<DomainId,Time> source_latencies_late_;
+
+        //Look-up tables built by freeze()
+        bool frozen_ = false;
+
+        //The ids of the analyzed domain pairs, indexed by [src_domain][sink_domain]
+        //(INVALID() if the pair is never analyzed)
+        std::vector<DomainPairId> domain_pair_matrix_;
+
+        tatum::util::linear_map<DomainPairId,DomainPairId> domain_pair_ids_;
+        tatum::util::linear_map<DomainPairId,DomainId> domain_pair_src_domains_;
+        tatum::util::linear_map<DomainPairId,DomainId> domain_pair_sink_domains_;
+
+        //Whether the domain pair has a default (i.e. non-capture node specific) setup or hold
+        //constraint. If not, the pair is only analyzed at capture nodes with a specific constraint.
+        tatum::util::linear_map<DomainPairId,bool> domain_pair_has_default_constraint_;
+
+        //The default setup/hold constraints (NaN if unspecified) and clock uncertainties (zero
+        //if unspecified), indexed like domain_pair_matrix_
+        tatum::util::aligned_vector<Time> setup_constraint_matrix_;
+        tatum::util::aligned_vector<Time> hold_constraint_matrix_;
+        tatum::util::aligned_vector<Time> setup_clock_uncertainty_matrix_;
+        tatum::util::aligned_vector<Time> hold_clock_uncertainty_matrix_;
+
+        //The source latency of each domain (zero if unspecified)
+        tatum::util::linear_map<DomainId,Time> early_source_latency_table_;
+        tatum::util::linear_map<DomainId,Time> late_source_latency_table_;
+
+        //The capture node specific constraints, grouped by capture node: those of node
+        //lie in [capture_node_constraints_begin_[node], capture_node_constraints_begin_[node+1]).
+        //Nodes beyond the end of capture_node_constraints_begin_ have none.
+        std::vector<size_t> capture_node_constraints_begin_;
+        std::vector<CaptureNodeConstraint> capture_node_constraints_;
+
+        //Per-node look-up tables, indexed by node. Nodes beyond the end of a table are not
+        //constant generators or clock sources, and have no clock domain.
+        std::vector<bool> constant_generator_nodes_;
+        std::vector<bool> clock_source_nodes_;
+        tatum::util::linear_map<NodeId,DomainId> node_clock_domains_;
+
+        NodeIoConstraints max_node_input_constraints_;
+        NodeIoConstraints min_node_input_constraints_;
+        NodeIoConstraints max_node_output_constraints_;
+        NodeIoConstraints min_node_output_constraints_;
 };
 
 /*
@@ -219,6 +322,14 @@ struct NodeDomainPair {
     NodeId capture_node; //Should be treated as a wild-card if capture_node is NodeId::INVALID()
 };
 
+//A frozen capture node specific constraint (see TimingConstraints::freeze()).
+//Setup or hold constraints not specified at the capture node hold the domain pair's default.
+struct CaptureNodeConstraint {
+    DomainPairId domain_pair;
+    Time setup_constraint;
+    Time hold_constraint;
+};
+
 struct IoConstraint {
     IoConstraint(DomainId domain_id, Time constraint_val): domain(domain_id), constraint(constraint_val) {}
 
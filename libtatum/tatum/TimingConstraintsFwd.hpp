@@ -1,4 +1,5 @@
 #pragma once
+#include "tatum/util/tatum_strong_id.hpp"
 
 namespace tatum {
 
@@ -6,6 +7,11 @@ namespace tatum {
 struct DomainPair;
 struct NodeDomainPair;
 struct IoConstraint;
+struct CaptureNodeConstraint;
 class TimingConstraints;
 
+//Dense id of an analyzed (launch, capture) clock domain pair (see TimingConstraints::freeze())
+struct domain_pair_id_tag;
+typedef tatum::util::StrongId<domain_pair_id_tag> DomainPairId;
+
 } //namepsace
@@ -75,13 +75,15 @@ TimingReporter::TimingReporter(const TimingGraphNameResolver& name_resolver,
                                const TimingGraph& timing_graph, 
                                const TimingConstraints& timing_constraints, 
                                float unit_scale,
-                               size_t precision)
+                               size_t precision,
+                               size_t corner)
     : name_resolver_(name_resolver)
     , timing_graph_(timing_graph)
     , timing_constraints_(timing_constraints)
     , unit_scale_(unit_scale)
-    , precision_(precision) {
-    //pass
+    , precision_(precision)
+    , corner_(corner) {
+    TATUM_ASSERT(corner_ < Time::num_corners());
 }
 
 void TimingReporter::report_timing_setup(std::string filename, 
@@ -94,7 +96,7 @@ void TimingReporter::report_timing_setup(std::string filename,
 void TimingReporter::report_timing_setup(std::ostream& os, 
                                          const SetupTimingAnalyzer& setup_analyzer,
                                          size_t npaths) const {
-    auto paths = path_collector_.collect_worst_setup_timing_paths(timing_graph_, setup_analyzer, npaths);
+    auto paths = path_collector_.collect_worst_setup_timing_paths(timing_graph_, setup_analyzer, npaths, corner_);
 
     report_timing(os, paths);
 }
@@ -103,7 +105,7 @@ void TimingReporter::report_timing_setup(std::vector<tatum::TimingPath>& paths,
                                          std::ostream& os,
                                          const SetupTimingAnalyzer& setup_analyzer,
                                          size_t npaths) const {
-    paths = path_collector_.collect_worst_setup_timing_paths(timing_graph_, setup_analyzer, npaths);
+    paths = path_collector_.collect_worst_setup_timing_paths(timing_graph_, setup_analyzer, npaths, corner_);
 
     report_timing(os, paths);
 }
@@ -118,7 +120,7 @@ void TimingReporter::report_timing_hold(std::string filename,
 void TimingReporter::report_timing_hold(std::ostream& os, 
                                          const HoldTimingAnalyzer& hold_analyzer,
                                          size_t npaths) const {
-    auto paths = path_collector_.collect_worst_hold_timing_paths(timing_graph_, hold_analyzer, npaths);
+    auto paths = path_collector_.collect_worst_hold_timing_paths(timing_graph_, hold_analyzer, npaths, corner_);
 
     report_timing(os, paths);
 }
@@ -127,7 +129,7 @@ void TimingReporter::report_timing_hold(std::vector<tatum::TimingPath>& paths,
                                          std::ostream& os,
                                          const HoldTimingAnalyzer& hold_analyzer,
                                          size_t npaths) const {
-    paths = path_collector_.collect_worst_hold_timing_paths(timing_graph_, hold_analyzer, npaths);
+    paths = path_collector_.collect_worst_hold_timing_paths(timing_graph_, hold_analyzer, npaths, corner_);
 
     report_timing(os, paths);
 }
@@ -142,7 +144,7 @@ void TimingReporter::report_skew_setup(std::string filename,
 void TimingReporter::report_skew_setup(std::ostream& os, 
                                          const SetupTimingAnalyzer& setup_analyzer,
                                          size_t nworst) const {
-    auto paths = path_collector_.collect_worst_setup_skew_paths(timing_graph_, timing_constraints_, setup_analyzer, nworst);
+    auto paths = path_collector_.collect_worst_setup_skew_paths(timing_graph_, timing_constraints_, setup_analyzer, nworst, corner_);
 
     os << "#Clock skew for setup timing startpoint/endpoint\n";
     os << "\n";
@@ -160,7 +162,7 @@ void TimingReporter::report_skew_hold(std::string filename,
 void TimingReporter::report_skew_hold(std::ostream& os, 
                                          const HoldTimingAnalyzer& hold_analyzer,
                                          size_t nworst) const {
-    auto paths = path_collector_.collect_worst_hold_skew_paths(timing_graph_, timing_constraints_, hold_analyzer, nworst);
+    auto paths = path_collector_.collect_worst_hold_skew_paths(timing_graph_, timing_constraints_, hold_analyzer, nworst, corner_);
 
     os << "#Clock skew for hold timing startpoint/endpoint\n";
     os << "\n";
@@ -176,7 +178,8 @@ void TimingReporter::report_unconstrained_setup(std::string filename,
 
 void TimingReporter::report_unconstrained_setup(std::ostream& os, 
                                                           const tatum::SetupTimingAnalyzer& setup_analyzer) const {
-    detail::SetupTagRetriever tag_retriever(setup_analyzer);
+    detail::SetupTagRetriever setup_tag_retriever(setup_analyzer);
+    detail::CornerTagRetriever tag_retriever(timing_graph_, setup_tag_retriever, corner_);
 
     os << "#Unconstrained setup timing startpoint/endpoint\n";
     os << "\n";
@@ -196,7 +199,8 @@ void TimingReporter::report_unconstrained_hold(std::string filename,
 
 void TimingReporter::report_unconstrained_hold(std::ostream& os, 
                                                          const tatum::HoldTimingAnalyzer& hold_analyzer) const {
-    detail::HoldTagRetriever tag_retriever(hold_analyzer);
+    detail::HoldTagRetriever hold_tag_retriever(hold_analyzer);
+    detail::CornerTagRetriever tag_retriever(timing_graph_, hold_tag_retriever, corner_);
 
     os << "#Unconstrained hold timing startpoint/endpoint\n";
     os << "\n";
@@ -60,7 +60,8 @@ class TimingReporter {
                        const tatum::TimingGraph& timing_graph, 
                        const tatum::TimingConstraints& timing_constraints, 
                        float unit_scale=1e-9,
-                       size_t precision=3);
+                       size_t precision=3,
+                       size_t corner=0);
     public:
         void report_timing_setup(std::string filename, const tatum::SetupTimingAnalyzer& setup_analyzer, size_t npaths=REPORT_TIMING_DEFAULT_NPATHS) const;
         void report_timing_setup(std::ostream& os, const tatum::SetupTimingAnalyzer& setup_analyzer, size_t npaths=REPORT_TIMING_DEFAULT_NPATHS) const;
@@ -153,6 +154,7 @@ class TimingReporter {
         const TimingConstraints& timing_constraints_;
         float unit_scale_ = 1e-9;
         size_t precision_ = 3;
+        size_t corner_ = 0; //Timing corner reported (see Time)
 
         float relative_error_tolerance_ = 1.e-5;
         float absolute_error_tolerance_ = 1e-13; //Sub pico-second
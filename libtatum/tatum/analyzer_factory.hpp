@@ -45,6 +45,15 @@ namespace tatum {
  *                                                                                         timing_constraints,
  *                                                                                         delay_calculator);
  *
+ * By default the analyzer accesses the delay calculator through the DelayCalculator
+ * interface (i.e. with a virtual call per delay lookup). Specifying the concrete delay
+ * calculator type allows the delay lookups to be inlined into the analysis (provided the
+ * calculator, or its delay methods, are final):
+ *
+ *      auto fast_setup_analyzer = AnalyzerFactory<SetupAnalysis,SerialWalker,MyDelayCalculator>::make(timing_graph,
+ *                                                                                                   timing_constraints,
+ *                                                                                                   delay_calculator);
+ *
  * The AnalzyerFactory returns a std::unique_ptr to the appropriate TimingAnalyzer sub-class:
  *
  *      SetupAnalysis       =>  SetupTimingAnalyzer
@@ -56,8 +65,10 @@ namespace tatum {
 ///
 ///\tparam Visitor The analysis type visitor (e.g. SetupAnalysis)
 ///\tparam GraphWalker The graph walker to use (defaults to serial traversals)
+///\tparam DelayCalc The type of delay calculator to use (defaults to the DelayCalculator interface)
 template<class Visitor,
-         class GraphWalker>
+         class GraphWalker,
+         class DelayCalc>
 struct AnalyzerFactory {
 
     //We use the dependent_false template to detect if the un-specialized AnalyzerFactor 
@@ -82,96 +93,84 @@ struct AnalyzerFactory {
     ///\returns std::unique_ptr to the analyzer
     static std::unique_ptr<TimingAnalyzer> make(const TimingGraph& timing_graph,
                                                 const TimingConstraints& timing_constraints,
-                                                const DelayCalculator& delay_calc);
+                                                const DelayCalc& delay_calc);
 };
 
 //Specialize for setup
-template<class GraphWalker>
-struct AnalyzerFactory<SetupAnalysis,GraphWalker> {
+template<class GraphWalker, class DelayCalc>
+struct AnalyzerFactory<SetupAnalysis,GraphWalker,DelayCalc> {
 
     static std::unique_ptr<SetupTimingAnalyzer> make(const TimingGraph& timing_graph,
                                                      const TimingConstraints& timing_constraints,
-                                                     const DelayCalculator& delay_calc) {
+                                                     const DelayCalc& delay_calc) {
         return std::unique_ptr<SetupTimingAnalyzer>(
-                new detail::FullSetupTimingAnalyzer<GraphWalker>(timing_graph, 
-                                                                 timing_constraints, 
-                                                                 delay_calc)
+                new detail::FullSetupTimingAnalyzer<GraphWalker,DelayCalc>(timing_graph, timing_constraints, delay_calc)
                 );
     }
 };
 
 //Specialize for hold
-template<class GraphWalker>
-struct AnalyzerFactory<HoldAnalysis,GraphWalker> {
+template<class GraphWalker, class DelayCalc>
+struct AnalyzerFactory<HoldAnalysis,GraphWalker,DelayCalc> {
 
     static std::unique_ptr<HoldTimingAnalyzer> make(const TimingGraph& timing_graph,
                                                     const TimingConstraints& timing_constraints,
-                                                    const DelayCalculator& delay_calc) {
+                                                    const DelayCalc& delay_calc) {
         return std::unique_ptr<HoldTimingAnalyzer>(
-                new detail::FullHoldTimingAnalyzer<GraphWalker>(timing_graph,
-                                                                timing_constraints, 
-                                                                delay_calc)
+                new detail::FullHoldTimingAnalyzer<GraphWalker,DelayCalc>(timing_graph, timing_constraints, delay_calc)
                 );
     }
 };
 
 //Specialize for combined setup and hold
-template<class GraphWalker>
-struct AnalyzerFactory<SetupHoldAnalysis,GraphWalker> {
+template<class GraphWalker, class DelayCalc>
+struct AnalyzerFactory<SetupHoldAnalysis,GraphWalker,DelayCalc> {
 
     static std::unique_ptr<SetupHoldTimingAnalyzer> make(const TimingGraph& timing_graph,
                                                          const TimingConstraints& timing_constraints,
-                                                         const DelayCalculator& delay_calc) {
+                                                         const DelayCalc& delay_calc) {
         return std::unique_ptr<SetupHoldTimingAnalyzer>(
-                new detail::FullSetupHoldTimingAnalyzer<GraphWalker>(timing_graph, 
-                                                                     timing_constraints, 
-                                                                     delay_calc)
+                new detail::FullSetupHoldTimingAnalyzer<GraphWalker,DelayCalc>(timing_graph, timing_constraints, delay_calc)
                 );
     }
 };
 
 
 //Specialize for incremental setup
-template<>
-struct AnalyzerFactory<SetupAnalysis,SerialIncrWalker> {
+template<class DelayCalc>
+struct AnalyzerFactory<SetupAnalysis,SerialIncrWalker,DelayCalc> {
 
     static std::unique_ptr<SetupTimingAnalyzer> make(const TimingGraph& timing_graph,
                                                          const TimingConstraints& timing_constraints,
-                                                         const DelayCalculator& delay_calc) {
+                                                         const DelayCalc& delay_calc) {
         return std::unique_ptr<SetupTimingAnalyzer>(
-                new detail::IncrSetupTimingAnalyzer<SerialIncrWalker>(timing_graph, 
-                                                                      timing_constraints, 
-                                                                      delay_calc)
+                new detail::IncrSetupTimingAnalyzer<SerialIncrWalker,DelayCalc>(timing_graph, timing_constraints, delay_calc)
                 );
     }
 };
 
 //Specialize for incremental hold
-template<>
-struct AnalyzerFactory<HoldAnalysis,SerialIncrWalker> {
+template<class DelayCalc>
+struct AnalyzerFactory<HoldAnalysis,SerialIncrWalker,DelayCalc> {
 
     static std::unique_ptr<HoldTimingAnalyzer> make(const TimingGraph& timing_graph,
                                                          const TimingConstraints& timing_constraints,
-                                                         const DelayCalculator& delay_calc) {
+                                                         const DelayCalc& delay_calc) {
         return std::unique_ptr<HoldTimingAnalyzer>(
-                new detail::IncrHoldTimingAnalyzer<SerialIncrWalker>(timing_graph, 
-                                                                     timing_constraints, 
-                                                                     delay_calc)
+                new detail::IncrHoldTimingAnalyzer<SerialIncrWalker,DelayCalc>(timing_graph, timing_constraints, delay_calc)
                 );
     }
 };
 
 //Specialize for combined incremental setup and hold
-template<>
-struct AnalyzerFactory<SetupHoldAnalysis,SerialIncrWalker> {
+template<class DelayCalc>
+struct AnalyzerFactory<SetupHoldAnalysis,SerialIncrWalker,DelayCalc> {
 
     static std::unique_ptr<SetupHoldTimingAnalyzer> make(const TimingGraph& timing_graph,
                                                          const TimingConstraints& timing_constraints,
-                                                         const DelayCalculator& delay_calc) {
+                                                         const DelayCalc& delay_calc) {
         return std::unique_ptr<SetupHoldTimingAnalyzer>(
-                new detail::IncrSetupHoldTimingAnalyzer<SerialIncrWalker>(timing_graph, 
-                                                                          timing_constraints, 
-                                                                          delay_calc)
+                new detail::IncrSetupHoldTimingAnalyzer<SerialIncrWalker,DelayCalc>(timing_graph, timing_constraints, delay_calc)
                 );
     }
 };
@@ -5,12 +5,16 @@
 
 namespace tatum {
 
+class DelayCalculator;
+
 ///Factor class to construct timing analyzers
 ///
 ///\tparam Visitor The analysis type visitor (e.g. SetupAnalysis)
 ///\tparam GraphWalker The graph walker to use (defaults to serial traversals)
+///\tparam DelayCalc The type of delay calculator to use (defaults to the DelayCalculator interface)
 template<class Visitor,
-         class GraphWalker=SerialWalker>
+         class GraphWalker=SerialWalker,
+         class DelayCalc=DelayCalculator>
 struct AnalyzerFactory;
 
 } //namepsace
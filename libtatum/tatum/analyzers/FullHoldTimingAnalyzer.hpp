@@ -13,10 +13,10 @@ namespace tatum { namespace detail {
  * re-analyzes the timing graph whenever update_timing_impl() is 
  * called.
  */
-template<class GraphWalker=SerialWalker>
+template<class GraphWalker=SerialWalker, class DelayCalc=DelayCalculator>
 class FullHoldTimingAnalyzer : public HoldTimingAnalyzer {
     public:
-        FullHoldTimingAnalyzer(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const DelayCalculator& delay_calculator)
+        FullHoldTimingAnalyzer(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const DelayCalc& delay_calculator)
             : HoldTimingAnalyzer()
             , timing_graph_(timing_graph)
             , timing_constraints_(timing_constraints)
@@ -48,6 +48,13 @@ class FullHoldTimingAnalyzer : public HoldTimingAnalyzer {
 
             graph_walker_.do_update_slack(timing_graph_, delay_calculator_, hold_visitor_);
 
+            if (!tags_packed_) {
+                //Now that a full analysis has determined how many tags each node
+                //requires, move them into a single exactly-sized block
+                hold_visitor_.pack_tags();
+                tags_packed_ = true;
+            }
+
             double analysis_sec = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
 
             //Record profiling data
@@ -57,10 +64,58 @@ class FullHoldTimingAnalyzer : public HoldTimingAnalyzer {
             graph_walker_.set_profiling_data("num_full_updates", graph_walker_.get_profiling_data("num_full_updates") + 1);
         }
 
+        virtual void update_endpoint_timing_impl() override {
+            //Nothing can be deferred in a full analysis
+            update_timing_impl();
+        }
+
+        virtual bool has_deferred_update_impl() const override {
+            return false;
+        }
+
         virtual void invalidate_edge_impl(const EdgeId edge) override {
             graph_walker_.invalidate_edge(edge);
         }
 
+        virtual void invalidate_edges_impl(const edge_range edges) override {
+            graph_walker_.invalidate_edges(edges);
+        }
+
+        virtual void set_incr_invalidation_policy_impl(const IncrInvalidationPolicy policy) override {
+            graph_walker_.set_incr_invalidation_policy(policy);
+        }
+
+        virtual void set_clock_network_caching_impl(bool enable) override {
+            graph_walker_.set_clock_network_caching(enable);
+        }
+
+        virtual void set_dominated_tag_pruning_impl(bool enable) override {
+            hold_visitor_.set_dominated_tag_pruning(timing_constraints_, enable);
+        }
+
+        virtual void set_slack_threshold_impl(const Time threshold) override {
+            hold_visitor_.set_slack_threshold(threshold, timing_graph_.nodes().size());
+        }
+
+        virtual void set_timing_derate_impl(const TimingDerate& derate) override {
+            hold_visitor_.set_timing_derate(timing_graph_, derate);
+
+            //Any cached clock network timing used the previous derates
+            invalidate_all_edges();
+        }
+
+        virtual void set_common_clock_pessimism_removal_impl(bool enable) override {
+            std::shared_ptr<const CommonClockIndex> index;
+            if (enable) {
+                index = std::make_shared<CommonClockIndex>(timing_graph_, timing_constraints_);
+            }
+            set_common_clock_index_impl(std::move(index));
+        }
+
+        virtual void set_common_clock_index_impl(std::shared_ptr<const CommonClockIndex> index) override {
+            hold_visitor_.set_common_clock_index(std::move(index));
+        }
+
         virtual node_range modified_nodes_impl() const override {
             return graph_walker_.modified_nodes();
         }
@@ -76,13 +131,21 @@ class FullHoldTimingAnalyzer : public HoldTimingAnalyzer {
 #endif
         TimingTags::tag_range hold_node_slacks_impl(NodeId node_id) const override { return hold_visitor_.hold_node_slacks(node_id); }
 
+    private:
+        //Invalidates every edge, so any cached timing is re-calculated on the next update
+        void invalidate_all_edges() {
+            graph_walker_.invalidate_edges(timing_graph_.edges());
+        }
+
     private:
         const TimingGraph& timing_graph_;
         const TimingConstraints& timing_constraints_;
-        const DelayCalculator& delay_calculator_;
-        HoldAnalysis hold_visitor_;
+        const DelayCalc& delay_calculator_;
+        BasicHoldAnalysis<DelayCalc> hold_visitor_;
         GraphWalker graph_walker_;
 
+        bool tags_packed_ = false;
+
         typedef std::chrono::duration<double> dsec;
         typedef std::chrono::high_resolution_clock Clock;
 };
@@ -3,6 +3,7 @@
 #include "tatum/HoldAnalysis.hpp"
 #include "tatum/analyzers/HoldTimingAnalyzer.hpp"
 #include "tatum/base/validate_timing_graph_constraints.hpp"
+#include "tatum/error.hpp"
 
 namespace tatum { namespace detail {
 
@@ -13,10 +14,10 @@ namespace tatum { namespace detail {
  * update the timing graph based on edges which have been marked
  * as invalidated.
  */
-template<class GraphWalker=SerialIncrWalker>
+template<class GraphWalker=SerialIncrWalker, class DelayCalc=DelayCalculator>
 class IncrHoldTimingAnalyzer : public HoldTimingAnalyzer {
     public:
-        IncrHoldTimingAnalyzer(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const DelayCalculator& delay_calculator)
+        IncrHoldTimingAnalyzer(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const DelayCalc& delay_calculator)
             : HoldTimingAnalyzer()
             , timing_graph_(timing_graph)
             , timing_constraints_(timing_constraints)
@@ -29,6 +30,7 @@ class IncrHoldTimingAnalyzer : public HoldTimingAnalyzer {
             graph_walker_.set_profiling_data("analysis_sec", 0.);
             graph_walker_.set_profiling_data("num_full_updates", 0.);
             graph_walker_.set_profiling_data("num_incr_updates", 0.);
+            graph_walker_.set_profiling_data("num_endpoint_updates", 0.);
         }
 
     protected:
@@ -40,10 +42,7 @@ class IncrHoldTimingAnalyzer : public HoldTimingAnalyzer {
             auto start_time = Clock::now();
 
             if (never_updated_) {
-                //Invalidate all edges
-                for (EdgeId edge : timing_graph_.edges()) {
-                    graph_walker_.invalidate_edge(edge);
-                }
+                invalidate_all_edges();
 
                 //Only need to pre-traverse the first update
                 graph_walker_.do_arrival_pre_traversal(timing_graph_, timing_constraints_, hold_visitor_);            
@@ -60,6 +59,12 @@ class IncrHoldTimingAnalyzer : public HoldTimingAnalyzer {
 
             graph_walker_.do_update_slack(timing_graph_, delay_calculator_, hold_visitor_);
 
+            if (never_updated_) {
+                //Now that a full analysis has determined how many tags each node
+                //requires, move them into a single exactly-sized block
+                hold_visitor_.pack_tags();
+            }
+
             double analysis_sec = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
 
             graph_walker_.clear_invalidated_edges();
@@ -68,15 +73,102 @@ class IncrHoldTimingAnalyzer : public HoldTimingAnalyzer {
             double total_analysis_sec = analysis_sec + graph_walker_.get_profiling_data("total_analysis_sec");
             graph_walker_.set_profiling_data("total_analysis_sec", total_analysis_sec);
             graph_walker_.set_profiling_data("analysis_sec", analysis_sec);
-            graph_walker_.set_profiling_data("num_incr_updates", graph_walker_.get_profiling_data("num_incr_updates") + 1);
+            if (graph_walker_.get_profiling_data("incr_fallback_to_full") == 1.) {
+                //The walker decided a full update would be faster
+                graph_walker_.set_profiling_data("num_full_updates", graph_walker_.get_profiling_data("num_full_updates") + 1);
+            } else {
+                graph_walker_.set_profiling_data("num_incr_updates", graph_walker_.get_profiling_data("num_incr_updates") + 1);
+            }
 
             never_updated_ = false;
+            deferred_update_ = false;
+        }
+
+        virtual void update_endpoint_timing_impl() override {
+            if (never_updated_) {
+                //The initial update is always complete
+                update_timing_impl();
+                return;
+            }
+
+            auto start_time = Clock::now();
+
+            graph_walker_.do_arrival_traversal(timing_graph_, timing_constraints_, delay_calculator_, hold_visitor_);            
+
+            //The required traversal (and non-endpoint slacks) are deferred until the next update_timing()
+            graph_walker_.do_update_endpoint_slack(timing_graph_, delay_calculator_, hold_visitor_);
+
+            double analysis_sec = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
+
+            //Note that the invalidated edges are not cleared, since the deferred
+            //required traversal still needs to process them
+
+            //Record profiling data
+            double total_analysis_sec = analysis_sec + graph_walker_.get_profiling_data("total_analysis_sec");
+            graph_walker_.set_profiling_data("total_analysis_sec", total_analysis_sec);
+            graph_walker_.set_profiling_data("analysis_sec", analysis_sec);
+            graph_walker_.set_profiling_data("num_endpoint_updates", graph_walker_.get_profiling_data("num_endpoint_updates") + 1);
+
+            deferred_update_ = true;
+        }
+
+        virtual bool has_deferred_update_impl() const override {
+            return deferred_update_;
         }
 
         virtual void invalidate_edge_impl(const EdgeId edge) override {
             graph_walker_.invalidate_edge(edge);
         }
 
+        virtual void invalidate_edges_impl(const edge_range edges) override {
+            graph_walker_.invalidate_edges(edges);
+        }
+
+        virtual void set_incr_invalidation_policy_impl(const IncrInvalidationPolicy policy) override {
+            graph_walker_.set_incr_invalidation_policy(policy);
+        }
+
+        virtual void set_clock_network_caching_impl(bool enable) override {
+            graph_walker_.set_clock_network_caching(enable);
+        }
+
+        virtual void set_dominated_tag_pruning_impl(bool enable) override {
+            hold_visitor_.set_dominated_tag_pruning(timing_constraints_, enable);
+
+            //The existing tags were calculated with the previous pruning setting
+            if (!never_updated_) invalidate_all_edges();
+        }
+
+        virtual void set_slack_threshold_impl(const Time threshold) override {
+            //The bounds depend on endpoint slacks (i.e. arrival times) which incremental 
+            //updates do not track through the required time traversal
+            if (threshold.valid()) {
+                throw tatum::Error("Slack thresholds are not supported by incremental timing analyzers");
+            }
+        }
+
+        virtual void set_timing_derate_impl(const TimingDerate& derate) override {
+            hold_visitor_.set_timing_derate(timing_graph_, derate);
+
+            //The existing tags were calculated with the previous derates
+            if (!never_updated_) invalidate_all_edges();
+        }
+
+        virtual void set_common_clock_pessimism_removal_impl(bool enable) override {
+            std::shared_ptr<const CommonClockIndex> index;
+            if (enable) {
+                index = std::make_shared<CommonClockIndex>(timing_graph_, timing_constraints_);
+            }
+            set_common_clock_index_impl(std::move(index));
+        }
+
+        virtual void set_common_clock_index_impl(std::shared_ptr<const CommonClockIndex> index) override {
+            hold_visitor_.set_common_clock_index(std::move(index));
+
+            //The existing required times were calculated with the previous credits
+            if (!never_updated_) invalidate_all_edges();
+        }
+
         virtual node_range modified_nodes_impl() const override {
             return graph_walker_.modified_nodes();
         }
@@ -92,14 +184,21 @@ class IncrHoldTimingAnalyzer : public HoldTimingAnalyzer {
 #endif
         TimingTags::tag_range hold_node_slacks_impl(NodeId node_id) const override { return hold_visitor_.hold_node_slacks(node_id); }
 
+    private:
+        //Invalidates every edge, so the next update re-analyzes the whole graph
+        void invalidate_all_edges() {
+            graph_walker_.invalidate_edges(timing_graph_.edges());
+        }
+
     private:
         const TimingGraph& timing_graph_;
         const TimingConstraints& timing_constraints_;
-        const DelayCalculator& delay_calculator_;
-        HoldAnalysis hold_visitor_;
+        const DelayCalc& delay_calculator_;
+        BasicHoldAnalysis<DelayCalc> hold_visitor_;
         GraphWalker graph_walker_;
 
         bool never_updated_ = true;
+        bool deferred_update_ = false; //Whether the required traversal was deferred by update_endpoint_timing()
 
         typedef std::chrono::duration<double> dsec;
         typedef std::chrono::high_resolution_clock Clock;
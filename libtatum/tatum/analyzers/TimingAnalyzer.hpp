@@ -1,12 +1,19 @@
 #pragma once
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "tatum/TimingGraphFwd.hpp"
+#include "tatum/Time.hpp"
 #include "tatum/util/tatum_range.hpp"
+#include "tatum/util/tatum_aligned_alloc.hpp"
+#include "tatum/base/IncrInvalidationPolicy.hpp"
+#include "tatum/base/TimingDerate.hpp"
 
 namespace tatum {
 
+class CommonClockIndex;
+
 /**
  * TimingAnalyzer represents an abstract interface for all timing analyzers,
  * which can be:
@@ -28,15 +35,91 @@ namespace tatum {
 class TimingAnalyzer {
     public:
         typedef tatum::util::Range<std::vector<NodeId>::const_iterator> node_range;
+        typedef tatum::util::Range<std::vector<EdgeId>::const_iterator> edge_range;
     public:
         virtual ~TimingAnalyzer() {}
 
+        //Analyzers hold Times by value, whose (possibly extended) alignment plain new does not respect
+        static void* operator new(size_t size) { return util::aligned_new<alignof(Time)>(size); }
+        static void operator delete(void* ptr) { util::aligned_delete<alignof(Time)>(ptr); }
+
         ///Perform timing analysis to update timing information (i.e. arrival & required times)
         void update_timing() { update_timing_impl(); }
 
+        ///Performs only as much of a timing update as is required to determine the slacks of 
+        ///the timing endpoints (i.e. logical outputs), which is sufficient to determine the 
+        ///worst negative slack.
+        ///
+        ///Updating the required times and slacks of other nodes is deferred until the next call
+        ///to update_timing() (so until then they may be stale). Analyzers which do not support 
+        ///deferral perform a complete update.
+        void update_endpoint_timing() { update_endpoint_timing_impl(); }
+
+        ///Returns true if part of the last timing update was deferred by update_endpoint_timing()
+        bool has_deferred_update() const { return has_deferred_update_impl(); }
+
         ///Invalidates the specified edge in the timing graph (for incremental updates)
         void invalidate_edge(const EdgeId edge) { invalidate_edge_impl(edge); }
 
+        ///Invalidates the specified set of edges in the timing graph (for incremental updates)
+        ///This is more efficient than calling invalidate_edge() for each edge when many edges
+        ///have changed (e.g. after a routing iteration)
+        void invalidate_edges(const edge_range edges) { invalidate_edges_impl(edges); }
+        void invalidate_edges(const std::vector<EdgeId>& edges) { invalidate_edges_impl(tatum::util::make_range(edges.cbegin(), edges.cend())); }
+
+        ///Sets how timing tags are invalidated during incremental updates
+        ///(has no effect on analyzers which only perform full updates)
+        void set_incr_invalidation_policy(const IncrInvalidationPolicy policy) { set_incr_invalidation_policy_impl(policy); }
+
+        ///Sets whether full analyzers calculate the clock network's timing once and re-use
+        ///it on later updates, until an edge feeding the clock network is invalidated.
+        ///
+        ///This requires that all delay changes are reported with invalidate_edge(s)(), 
+        ///even for full analyzers, so is disabled by default. Incremental analyzers
+        ///already only update the clock network when its edges are invalidated.
+        void set_clock_network_caching(bool enable) { set_clock_network_caching_impl(enable); }
+
+        ///Sets whether data arrival tags which can never determine the worst slack of any endpoint
+        ///(since another tag at the same node is always at least as critical) are pruned during
+        ///analysis. This reduces the number of tags when many clock domains interact.
+        ///
+        ///Pruning preserves the worst slack of each endpoint (and so WNS and TNS), but the slacks 
+        ///of other nodes, per domain pair results and timing reports may be incomplete, so it is
+        ///disabled by default. Pruning depends on the clock constraints, so should be re-enabled
+        ///if they change.
+        void set_dominated_tag_pruning(bool enable) { set_dominated_tag_pruning_impl(enable); }
+
+        ///Sets a slack threshold, above which slacks need not be exact. Required times are
+        ///then not propagated through nodes where every path has more slack than the threshold,
+        ///which saves considerable work when most of the design easily meets timing.
+        ///
+        ///Slacks no larger than the threshold (and all endpoint slacks) remain exact. Larger slacks
+        ///are reported as lower bounds (which still exceed the threshold), possibly with an 
+        ///unspecified capture domain. An invalid threshold (the default) calculates all slacks exactly.
+        ///Incremental analyzers do not support slack thresholds, and throw tatum::Error if given a valid one.
+        void set_slack_threshold(const Time threshold) { set_slack_threshold_impl(threshold); }
+
+        ///Sets the on-chip variation (OCV) derating applied to edge delays (see TimingDerate).
+        ///Derating is applied as edges are traversed, so adds no extra traversals. The whole
+        ///graph is re-analyzed on the next update.
+        void set_timing_derate(const TimingDerate& derate) { set_timing_derate_impl(derate); }
+
+        ///Sets whether common clock pessimism removal (CPPR) is performed. The pessimism of the clock
+        ///path shared by an endpoint's launch and capture clocks (e.g. due to early/late source latencies
+        ///or derates, see set_timing_derate()) is credited back to the endpoint's required times.
+        ///
+        ///Credits are block-based: each is calculated for the clock network node common to every
+        ///path from a launch domain to an endpoint (see CommonClockIndex), so never exceed the credit
+        ///of an individual path. Timing reports include the credit in the setup/hold time.
+        ///Dominated tag pruning is not performed while CPPR is enabled, and the whole graph is 
+        ///re-analyzed on the next update.
+        void set_common_clock_pessimism_removal(bool enable) { set_common_clock_pessimism_removal_impl(enable); }
+
+        ///Enables CPPR (as set_common_clock_pessimism_removal()) using a pre-built CommonClockIndex, which
+        ///may be shared by several analyzers of the same timing graph and constraints rather than each
+        ///building its own. A null index disables CPPR.
+        void set_common_clock_index(std::shared_ptr<const CommonClockIndex> index) { set_common_clock_index_impl(std::move(index)); }
+
         ///Returns the set of nodes which were modified by the last call to update_timing()
         node_range modified_nodes() const { return modified_nodes_impl(); }
 
@@ -48,8 +131,18 @@ class TimingAnalyzer {
     protected:
 
         virtual void update_timing_impl() = 0;
+        virtual void update_endpoint_timing_impl() = 0;
+        virtual bool has_deferred_update_impl() const = 0;
 
         virtual void invalidate_edge_impl(const EdgeId edge) = 0;
+        virtual void invalidate_edges_impl(const edge_range edges) = 0;
+        virtual void set_incr_invalidation_policy_impl(const IncrInvalidationPolicy policy) = 0;
+        virtual void set_clock_network_caching_impl(bool enable) = 0;
+        virtual void set_dominated_tag_pruning_impl(bool enable) = 0;
+        virtual void set_slack_threshold_impl(const Time threshold) = 0;
+        virtual void set_timing_derate_impl(const TimingDerate& derate) = 0;
+        virtual void set_common_clock_pessimism_removal_impl(bool enable) = 0;
+        virtual void set_common_clock_index_impl(std::shared_ptr<const CommonClockIndex> index) = 0;
         virtual node_range modified_nodes_impl() const = 0;
 
         virtual double get_profiling_data_impl(std::string key) const = 0;
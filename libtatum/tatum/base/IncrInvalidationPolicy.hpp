@@ -0,0 +1,15 @@
+#ifndef TATUM_INCR_INVALIDATION_POLICY_HPP
+#define TATUM_INCR_INVALIDATION_POLICY_HPP
+
+namespace tatum {
+
+//How timing tags are invalidated during an incremental timing update
+enum class IncrInvalidationPolicy {
+    BLOCK,   //Invalidate all of a node's tags (cheap per node, but pessimistic)
+    EDGE,    //Invalidate only tags whose origin is an invalidated edge (prunes more)
+    ADAPTIVE //Pick between BLOCK and EDGE based on observed re-traversal counts
+};
+
+} //namespace
+
+#endif
@@ -0,0 +1,74 @@
+#include <limits>
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/base/TimingDerate.hpp"
+#include "tatum/error.hpp"
+
+namespace tatum {
+
+bool TimingDerate::enabled() const {
+    for (const std::vector<float>& factors : factors_) {
+        for (float factor : factors) {
+            if (factor != 1.f) return true;
+        }
+    }
+    return false;
+}
+
+bool TimingDerate::depth_based() const {
+    for (const std::vector<float>& factors : factors_) {
+        if (factors.size() > 1) return true;
+    }
+    return false;
+}
+
+void TimingDerate::set_derate(const DeratePath path, const ArrivalType arrival, const float factor) {
+    set_depth_derate(path, arrival, {factor});
+}
+
+void TimingDerate::set_depth_derate(const DeratePath path, const ArrivalType arrival, const std::vector<float>& factors) {
+    if (factors.empty()) {
+        throw Error("Derate factors must not be empty");
+    }
+    for (float factor : factors) {
+        if (!(factor >= 0.f)) {
+            throw Error("Derate factors must be non-negative");
+        }
+    }
+
+    factors_[index(path, arrival)] = factors;
+}
+
+tatum::util::linear_map<EdgeId,size_t> calculate_edge_depths(const TimingGraph& tg) {
+    const size_t no_depth = std::numeric_limits<size_t>::max();
+
+    //The fewest edges on any path from a startpoint to each node.
+    //Since a node's fan-in is on earlier levels a single levelized pass suffices.
+    tatum::util::linear_map<NodeId,size_t> node_depths(tg.nodes().size(), no_depth);
+    for (LevelId level : tg.levels()) {
+        for (NodeId node : tg.level_nodes(level)) {
+            size_t depth = no_depth;
+            if (tg.node_type(node) != NodeType::SOURCE) {
+                for (EdgeId edge : tg.node_in_edges(node)) {
+                    if (tg.edge_disabled(edge)) continue;
+
+                    depth = std::min(depth, node_depths[tg.edge_src_node(edge)] + 1);
+                }
+            }
+
+            node_depths[node] = (depth == no_depth) ? 0 : depth; //Startpoint
+        }
+    }
+
+    tatum::util::linear_map<EdgeId,size_t> edge_depths(tg.edges().size(), 0);
+    for (EdgeId edge : tg.edges()) {
+        if (tg.node_type(tg.edge_sink_node(edge)) == NodeType::SOURCE) {
+            edge_depths[edge] = 0; //Clock launch edges begin the data path
+        } else {
+            edge_depths[edge] = node_depths[tg.edge_src_node(edge)];
+        }
+    }
+    return edge_depths;
+}
+
+} //namespace
@@ -0,0 +1,76 @@
+#ifndef TATUM_TIMING_DERATE_HPP
+#define TATUM_TIMING_DERATE_HPP
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "tatum/TimingGraphFwd.hpp"
+#include "tatum/base/ArrivalType.hpp"
+#include "tatum/util/tatum_linear_map.hpp"
+
+namespace tatum {
+
+//The type of path an edge delay is derated as part of
+enum class DeratePath {
+    CLOCK, //Clock network (launch and capture clock paths)
+    DATA   //Data paths (including clock-to-q delays)
+};
+
+/**
+ * On-chip variation (OCV) derating factors, which scale edge delays to model
+ * variation across the chip (see timing_analyzers.hpp).
+ *
+ * Separate factors are specified for clock and data paths, and for early and late
+ * arrivals. A setup analysis applies the late factors to the launch clock and data
+ * paths, and the early clock factor to the capture clock path (vice versa for hold).
+ * Setup and hold times are not derated.
+ *
+ * Each factor is either fixed, or a table indexed by edge depth (the last entry applying
+ * to all deeper edges), so the derate can fall off along deeper paths. Since the analysis
+ * is block-based the depth is per edge rather than per path: an edge's depth is the
+ * fewest edges preceding it on any path from a SOURCE node (or node without fan-in),
+ * which selects the most pessimistic (shallowest) entry of a table which falls off with
+ * depth. Clock launch (clock-to-q) edges begin the data path, so have depth zero.
+ *
+ * By default all factors are one (i.e. no derating).
+ */
+class TimingDerate {
+    public: //Accessors
+        ///Returns the factor applied to delays on the specified path and arrival type at the
+        ///specified edge depth
+        float factor(const DeratePath path, const ArrivalType arrival, const size_t depth=0) const {
+            const std::vector<float>& factors = factors_[index(path, arrival)];
+            return factors[std::min(depth, factors.size() - 1)];
+        }
+
+        ///Returns true if any delay is derated (i.e. some factor is not one)
+        bool enabled() const;
+
+        ///Returns true if any factor depends on edge depth
+        bool depth_based() const;
+
+    public: //Mutators
+        ///Sets a fixed derate factor for the specified path and arrival type
+        void set_derate(const DeratePath path, const ArrivalType arrival, const float factor);
+
+        ///Sets depth-based derate factors for the specified path and arrival type, where
+        ///factors[d] applies to edges at depth d (and factors.back() to deeper edges)
+        void set_depth_derate(const DeratePath path, const ArrivalType arrival, const std::vector<float>& factors);
+
+    private:
+        static size_t index(const DeratePath path, const ArrivalType arrival) {
+            return 2 * size_t(path) + size_t(arrival);
+        }
+
+    private:
+        //Indexed by index()
+        std::array<std::vector<float>,4> factors_ = {{{1.f}, {1.f}, {1.f}, {1.f}}};
+};
+
+///Returns the depth of each edge in the timing graph, as used for depth-based derating
+///(see TimingDerate)
+tatum::util::linear_map<EdgeId,size_t> calculate_edge_depths(const TimingGraph& tg);
+
+} //namespace
+
+#endif
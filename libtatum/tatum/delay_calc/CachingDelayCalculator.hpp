@@ -0,0 +1,185 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+
+#include "tatum/util/tatum_assert.hpp"
+#include "tatum/util/tatum_linear_map.hpp"
+#include "tatum/Time.hpp"
+#include "tatum/TimingGraph.hpp"
+#include "tatum/delay_calc/DelayCalculator.hpp"
+
+#ifdef TATUM_USE_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
+
+namespace tatum {
+
+/**
+ * A DelayCalculator which caches the delays of another (typically expensive) delay
+ * calculator.
+ *
+ * A timing analysis queries each edge's delays several times (e.g. during the arrival,
+ * required and slack traversals, and again when reporting). Instead update() calculates
+ * every edge's delays once, up front, using the wrapped calculator's batch methods on
+ * blocks of edges (in parallel if TBB is available), and all later queries are answered
+ * from the cache. After the first update() only edges marked with invalidate_edge(s)()
+ * are re-calculated.
+ *
+ * Like FixedDelayCalculator, the cached delays are stored by edge (max/min and setup/hold
+ * side-by-side). Only the delays used by the analysis are cached: the setup/hold times
+ * of clock capture edges (CPIN to SINK) and the max/min delays of all other edges. Other
+ * queries are forwarded to the wrapped calculator.
+ *
+ * Note that update() must be called after invalidating edges and before the next timing
+ * update, and that the wrapped calculator's batch methods are called concurrently.
+ *
+ * \see DelayCalculator
+ */
+class CachingDelayCalculator : public DelayCalculator {
+    public:
+        CachingDelayCalculator(const TimingGraph& tg, const DelayCalculator& delay_calc)
+            : tg_(tg)
+            , delay_calc_(delay_calc)
+            , edge_delays_(tg.edges().size())
+            , edge_times_(tg.edges().size())
+            , is_capture_edge_(tg.edges().size(), false)
+            , edge_stale_(tg.edges().size(), true) {
+            for (EdgeId edge_id : tg_.edges()) {
+                NodeId src_node = tg_.edge_src_node(edge_id);
+                NodeId sink_node = tg_.edge_sink_node(edge_id);
+                is_capture_edge_[edge_id] = (tg_.node_type(src_node) == NodeType::CPIN && tg_.node_type(sink_node) == NodeType::SINK);
+
+                if (is_capture_edge_[edge_id]) {
+                    stale_capture_edges_.push_back(edge_id);
+                } else {
+                    stale_delay_edges_.push_back(edge_id);
+                }
+            }
+        }
+
+        //Cached lookups
+        Time max_edge_delay(const TimingGraph& tg, EdgeId edge_id) const override {
+            if (is_capture_edge_[edge_id]) return delay_calc_.max_edge_delay(tg, edge_id);
+            TATUM_ASSERT_SAFE(!edge_stale_[edge_id]);
+            return edge_delays_[edge_id].max;
+        }
+        Time min_edge_delay(const TimingGraph& tg, EdgeId edge_id) const override {
+            if (is_capture_edge_[edge_id]) return delay_calc_.min_edge_delay(tg, edge_id);
+            TATUM_ASSERT_SAFE(!edge_stale_[edge_id]);
+            return edge_delays_[edge_id].min;
+        }
+        Time setup_time(const TimingGraph& tg, EdgeId edge_id) const override {
+            if (!is_capture_edge_[edge_id]) return delay_calc_.setup_time(tg, edge_id);
+            TATUM_ASSERT_SAFE(!edge_stale_[edge_id]);
+            return edge_times_[edge_id].setup;
+        }
+        Time hold_time(const TimingGraph& tg, EdgeId edge_id) const override {
+            if (!is_capture_edge_[edge_id]) return delay_calc_.hold_time(tg, edge_id);
+            TATUM_ASSERT_SAFE(!edge_stale_[edge_id]);
+            return edge_times_[edge_id].hold;
+        }
+
+        ///Marks the delays of the specified edge as changed, so they will be re-calculated
+        ///by the next update()
+        void invalidate_edge(const EdgeId edge_id) {
+            if (edge_stale_[edge_id]) return; //Already invalidated
+
+            edge_stale_[edge_id] = true;
+            if (is_capture_edge_[edge_id]) {
+                stale_capture_edges_.push_back(edge_id);
+            } else {
+                stale_delay_edges_.push_back(edge_id);
+            }
+        }
+
+        void invalidate_edges(const std::vector<EdgeId>& edges) {
+            for (EdgeId edge_id : edges) {
+                invalidate_edge(edge_id);
+            }
+        }
+
+        ///Re-calculates the delays of all invalidated edges (initially all edges)
+        void update() {
+            update(stale_delay_edges_, &DelayCalculator::max_edge_delays, &DelayCalculator::min_edge_delays,
+                   [this](EdgeId edge_id, Time max, Time min) {
+                       edge_delays_[edge_id].max = max;
+                       edge_delays_[edge_id].min = min;
+                   });
+            update(stale_capture_edges_, &DelayCalculator::setup_times, &DelayCalculator::hold_times,
+                   [this](EdgeId edge_id, Time setup, Time hold) {
+                       edge_times_[edge_id].setup = setup;
+                       edge_times_[edge_id].hold = hold;
+                   });
+        }
+
+    private:
+        typedef void (DelayCalculator::*BatchLookup)(const TimingGraph&, edge_range, Time*) const;
+
+        constexpr static size_t BLOCK_SIZE = 256; //Edges calculated at a time
+
+        template<class Store>
+        void update(std::vector<EdgeId>& stale_edges, BatchLookup first_lookup, BatchLookup second_lookup, const Store& store) {
+            const size_t num_blocks = (stale_edges.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+            //Calculates and stores the delays of the iblock'th block of stale edges
+            auto update_block = [&](size_t iblock) {
+                const size_t begin = iblock * BLOCK_SIZE;
+                const size_t end = std::min(begin + BLOCK_SIZE, stale_edges.size());
+
+                auto edges = tatum::util::make_range(stale_edges.cbegin() + begin, stale_edges.cbegin() + end);
+
+                Time first[BLOCK_SIZE];
+                Time second[BLOCK_SIZE];
+                (delay_calc_.*first_lookup)(tg_, edges, first);
+                (delay_calc_.*second_lookup)(tg_, edges, second);
+
+                for (size_t i = 0; i < end - begin; ++i) {
+                    EdgeId edge_id = stale_edges[begin + i];
+                    store(edge_id, first[i], second[i]);
+                    edge_stale_[edge_id] = false;
+                }
+            };
+
+#ifdef TATUM_USE_TBB
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, num_blocks), [&](const tbb::blocked_range<size_t>& blocks) {
+                for (size_t iblock = blocks.begin(); iblock != blocks.end(); ++iblock) {
+                    update_block(iblock);
+                }
+            });
+#else
+            for (size_t iblock = 0; iblock < num_blocks; ++iblock) {
+                update_block(iblock);
+            }
+#endif
+
+            stale_edges.clear();
+        }
+
+    private:
+        //As in FixedDelayCalculator
+        struct EdgeDelays {
+            Time max;
+            Time min;
+        };
+
+        struct EdgeTimes {
+            Time setup;
+            Time hold;
+        };
+
+        const TimingGraph& tg_;
+        const DelayCalculator& delay_calc_;
+
+        tatum::util::linear_map<EdgeId,EdgeDelays> edge_delays_;
+        tatum::util::linear_map<EdgeId,EdgeTimes> edge_times_;
+
+        tatum::util::linear_map<EdgeId,bool> is_capture_edge_; //Clock capture edges, whose setup/hold times are cached
+        tatum::util::linear_map<EdgeId,char> edge_stale_; //Whether each edge's cached delays are out of date
+                                                          //(char, since it is written concurrently)
+
+        std::vector<EdgeId> stale_delay_edges_; //Stale edges whose max/min delays are cached
+        std::vector<EdgeId> stale_capture_edges_; //Stale edges whose setup/hold times are cached
+};
+
+} //namepsace
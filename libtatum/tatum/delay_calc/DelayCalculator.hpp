@@ -1,14 +1,29 @@
 #pragma once
 
 #include "tatum/Time.hpp"
-#include "tatum/TimingGraphFwd.hpp"
+#include "tatum/TimingGraph.hpp"
 
 namespace tatum {
 
 /** 
  * Interface for a delay calculator
+ *
+ * With multiple timing corners (see Time) each corner of the returned delays
+ * specifies the delay in that corner.
+ *
+ * The batch methods (e.g. max_edge_delays()) look up the delays of a range of
+ * edges (e.g. a node's in-edges, or any collection of edges such as those of an
+ * entire level) with a single call, writing the delay of the i'th edge to delays[i]
+ * (which must have space for edges.size() values). By default they simply call the
+ * single edge methods, but may be overriden with more efficient implementations.
+ *
+ * The analyzers look up the min/max delays of each node's edges with a single batch
+ * call. The range may include disabled edges, whose delays are then ignored.
  */
 class DelayCalculator {
+    public:
+        typedef TimingGraph::edge_range edge_range;
+
     public:
         virtual ~DelayCalculator() {}
 
@@ -17,6 +32,20 @@ class DelayCalculator {
 
         virtual Time setup_time(const TimingGraph& tg, EdgeId edge_id) const = 0;
         virtual Time hold_time(const TimingGraph& tg, EdgeId edge_id) const = 0;
+
+        virtual void min_edge_delays(const TimingGraph& tg, edge_range edges, Time* delays) const {
+            for (EdgeId edge_id : edges) *delays++ = min_edge_delay(tg, edge_id);
+        }
+        virtual void max_edge_delays(const TimingGraph& tg, edge_range edges, Time* delays) const {
+            for (EdgeId edge_id : edges) *delays++ = max_edge_delay(tg, edge_id);
+        }
+
+        virtual void setup_times(const TimingGraph& tg, edge_range edges, Time* delays) const {
+            for (EdgeId edge_id : edges) *delays++ = setup_time(tg, edge_id);
+        }
+        virtual void hold_times(const TimingGraph& tg, edge_range edges, Time* delays) const {
+            for (EdgeId edge_id : edges) *delays++ = hold_time(tg, edge_id);
+        }
 };
 
 } //namepsace
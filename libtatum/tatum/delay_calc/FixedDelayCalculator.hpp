@@ -1,5 +1,7 @@
 #pragma once
+#include <algorithm>
 
+#include "tatum/util/tatum_assert.hpp"
 #include "tatum/util/tatum_linear_map.hpp"
 #include "tatum/Time.hpp"
 #include "tatum/TimingGraph.hpp"
@@ -11,6 +13,12 @@ namespace tatum {
  * An exmaple DelayCalculator implementation which takes 
  * a vector of fixed pre-calculated edge delays
  *
+ * The delays are stored by edge, with the max and min delays of each edge stored 
+ * side-by-side (as are the setup and hold times), so that a combined setup and hold 
+ * analysis reads a single contiguous block per edge. Since TimingGraph::optimize_layout() 
+ * numbers edges in traversal order, the delays are then also read in traversal order 
+ * provided they are re-ordered to match the graph (see remap_edges()).
+ *
  * \see DelayCalculator
  */
 class FixedDelayCalculator : public DelayCalculator {
@@ -21,10 +29,7 @@ class FixedDelayCalculator : public DelayCalculator {
         ///\param setup_times A container specifying the setup times delay for every sequential capture edge
         FixedDelayCalculator(const tatum::util::linear_map<EdgeId,Time>& max_edge_delays, 
                              const tatum::util::linear_map<EdgeId,Time>& setup_times)
-            : max_edge_delays_(max_edge_delays)
-            , setup_times_(setup_times)
-            , min_edge_delays_(max_edge_delays)
-            , hold_times_(setup_times) { }
+            : FixedDelayCalculator(max_edge_delays, setup_times, max_edge_delays, setup_times) { }
 
         ///Initializes the edge delays
         ///\param max_edge_delays A container specifying the maximum delay for every combinational edge
@@ -35,33 +40,96 @@ class FixedDelayCalculator : public DelayCalculator {
                              const tatum::util::linear_map<EdgeId,Time>& setup_times,
                              const tatum::util::linear_map<EdgeId,Time>& min_edge_delays, 
                              const tatum::util::linear_map<EdgeId,Time>& hold_times)
-            : max_edge_delays_(max_edge_delays)
-            , setup_times_(setup_times)
-            , min_edge_delays_(min_edge_delays)
-            , hold_times_(hold_times) { }
-            
+            : edge_delays_(max_edge_delays.size())
+            , edge_times_(setup_times.size()) {
+            TATUM_ASSERT(min_edge_delays.size() == max_edge_delays.size());
+            TATUM_ASSERT(hold_times.size() == setup_times.size());
+
+            for (size_t i = 0; i < edge_delays_.size(); ++i) {
+                EdgeId edge_id(i);
+                edge_delays_[edge_id].max = max_edge_delays[edge_id];
+                edge_delays_[edge_id].min = min_edge_delays[edge_id];
+            }
+
+            for (size_t i = 0; i < edge_times_.size(); ++i) {
+                EdgeId edge_id(i);
+                edge_times_[edge_id].setup = setup_times[edge_id];
+                edge_times_[edge_id].hold = hold_times[edge_id];
+            }
+        }
+
+        //The delay lookups are final, so they can be inlined by analyzers specialized
+        //on FixedDelayCalculator (see AnalyzerFactory)
+        Time max_edge_delay(const TimingGraph& /*tg*/, EdgeId edge_id) const final { return edge_delays_[edge_id].max; }
+
+        Time min_edge_delay(const TimingGraph& /*tg*/, EdgeId edge_id) const final { return edge_delays_[edge_id].min; }
+
+        Time setup_time(const TimingGraph& /*tg*/, EdgeId edge_id) const final { return edge_times_[edge_id].setup; }
 
+        Time hold_time(const TimingGraph& /*tg*/, EdgeId edge_id) const final { return edge_times_[edge_id].hold; }
 
-        Time max_edge_delay(const TimingGraph& /*tg*/, EdgeId edge_id) const override { return max_edge_delays_[edge_id]; }
+        void max_edge_delays(const TimingGraph& /*tg*/, edge_range edges, Time* delays) const final { 
+            for (EdgeId edge_id : edges) *delays++ = edge_delays_[edge_id].max;
+        }
 
-        Time min_edge_delay(const TimingGraph& /*tg*/, EdgeId edge_id) const override { return min_edge_delays_[edge_id]; }
+        void min_edge_delays(const TimingGraph& /*tg*/, edge_range edges, Time* delays) const final { 
+            for (EdgeId edge_id : edges) *delays++ = edge_delays_[edge_id].min;
+        }
 
-        Time setup_time(const TimingGraph& /*tg*/, EdgeId edge_id) const override { return setup_times_[edge_id]; }
+        void setup_times(const TimingGraph& /*tg*/, edge_range edges, Time* delays) const final { 
+            for (EdgeId edge_id : edges) *delays++ = edge_times_[edge_id].setup;
+        }
 
-        Time hold_time(const TimingGraph& /*tg*/, EdgeId edge_id) const override { return hold_times_[edge_id]; }
+        void hold_times(const TimingGraph& /*tg*/, edge_range edges, Time* delays) const final { 
+            for (EdgeId edge_id : edges) *delays++ = edge_times_[edge_id].hold;
+        }
 
         //Mutators
-        void set_max_edge_delay(const TimingGraph& /*tg*/, EdgeId edge_id, Time delay) { max_edge_delays_[edge_id] = delay; } 
-        void set_min_edge_delay(const TimingGraph& /*tg*/, EdgeId edge_id, Time delay) { min_edge_delays_[edge_id] = delay; } 
-        void set_setup_time(const TimingGraph& /*tg*/, EdgeId edge_id, Time delay) { setup_times_[edge_id] = delay; } 
-        void set_hold_time(const TimingGraph& /*tg*/, EdgeId edge_id, Time delay) { hold_times_[edge_id] = delay; } 
+        void set_max_edge_delay(const TimingGraph& /*tg*/, EdgeId edge_id, Time delay) { edge_delays_[edge_id].max = delay; } 
+        void set_min_edge_delay(const TimingGraph& /*tg*/, EdgeId edge_id, Time delay) { edge_delays_[edge_id].min = delay; } 
+        void set_setup_time(const TimingGraph& /*tg*/, EdgeId edge_id, Time delay) { edge_times_[edge_id].setup = delay; } 
+        void set_hold_time(const TimingGraph& /*tg*/, EdgeId edge_id, Time delay) { edge_times_[edge_id].hold = delay; } 
+
+        ///Re-orders the delays to follow the edges of a timing graph re-numbered by 
+        ///TimingGraph::optimize_layout() (or compress())
+        ///\param edge_id_map Maps from the original to new edge ids (i.e. GraphIdMaps::edge_id_map)
+        void remap_edges(const tatum::util::linear_map<EdgeId,EdgeId>& edge_id_map) {
+            edge_delays_ = remap(edge_delays_, edge_id_map);
+            edge_times_ = remap(edge_times_, edge_id_map);
+        }
  
     private:
-        tatum::util::linear_map<EdgeId,Time> max_edge_delays_;
-        tatum::util::linear_map<EdgeId,Time> setup_times_;
+        //The delays used by data and clock propagation, which are stored together
+        //so both setup and hold analysis read a single contiguous block per edge
+        struct EdgeDelays {
+            Time max;
+            Time min;
+        };
+
+        //The setup/hold times (only used by capture edges)
+        struct EdgeTimes {
+            Time setup;
+            Time hold;
+        };
+
+        template<typename T>
+        static tatum::util::linear_map<EdgeId,T> remap(const tatum::util::linear_map<EdgeId,T>& values, const tatum::util::linear_map<EdgeId,EdgeId>& edge_id_map) {
+            tatum::util::linear_map<EdgeId,T> new_values(values.size());
+            for (size_t i = 0; i < std::min(values.size(), edge_id_map.size()); ++i) {
+                EdgeId new_edge_id = edge_id_map[EdgeId(i)];
+                if (!new_edge_id) continue; //Removed edge
 
-        tatum::util::linear_map<EdgeId,Time> min_edge_delays_;
-        tatum::util::linear_map<EdgeId,Time> hold_times_;
+                if (size_t(new_edge_id) >= new_values.size()) {
+                    new_values.resize(size_t(new_edge_id) + 1);
+                }
+                new_values[new_edge_id] = values[EdgeId(i)];
+            }
+            return new_values;
+        }
+
+    private:
+        tatum::util::linear_map<EdgeId,EdgeDelays> edge_delays_;
+        tatum::util::linear_map<EdgeId,EdgeTimes> edge_times_;
 };
 
 } //namepsace
@@ -0,0 +1,198 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+
+#include "tatum/util/tatum_assert.hpp"
+#include "tatum/util/tatum_aligned_alloc.hpp"
+#include "tatum/Time.hpp"
+#include "tatum/TimingGraph.hpp"
+#include "tatum/delay_calc/DelayCalculator.hpp"
+#include "tatum/analyzers/TimingAnalyzer.hpp"
+
+#ifdef TATUM_USE_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
+
+namespace tatum {
+
+/**
+ * A DelayCalculator which wraps another delay calculator, and tracks which edge
+ * delays have changed since the last timing update.
+ *
+ * Rather than having the caller invalidate every edge which *may* have changed,
+ * find_changed_edges() compares each edge's current delays against those recorded
+ * at the previous call (i.e. those used by the last timing update), so only edges
+ * whose delays actually changed are invalidated (see invalidate_changed_edges()).
+ * Edges which were modified but ended up with their original delays are not
+ * re-analyzed.
+ *
+ * find_changed_edges() should be called once per timing update; its result may then
+ * be invalidated in any number of analyzers with invalidate_changed_edges().
+ *
+ * Edges disabled when the calculator is constructed are never tracked (they are not
+ * analyzed). If edges are enabled or disabled afterwards, a new TrackingDelayCalculator
+ * should be constructed (and every edge invalidated).
+ *
+ * Only the delays used by the analysis are compared: the setup/hold times of
+ * clock capture edges (CPIN to SINK) and the max/min delays of all other edges.
+ * The comparison fetches the delays of blocks of edges with the wrapped calculator's
+ * batch methods (see DelayCalculator), and processes the blocks in parallel if TBB
+ * is available.
+ *
+ * The wrapped calculator may also be passed to the analyzers directly (avoiding the
+ * forwarding here), provided all delay changes are reported by find_changed_edges().
+ *
+ * \see DelayCalculator
+ */
+class TrackingDelayCalculator : public DelayCalculator {
+    public:
+        TrackingDelayCalculator(const TimingGraph& tg, const DelayCalculator& delay_calc)
+            : tg_(tg)
+            , delay_calc_(delay_calc) {
+            for (EdgeId edge_id : tg_.edges()) {
+                if (tg_.edge_disabled(edge_id)) continue; //Never analyzed
+
+                NodeId src_node = tg_.edge_src_node(edge_id);
+                NodeId sink_node = tg_.edge_sink_node(edge_id);
+                if (tg_.node_type(src_node) == NodeType::CPIN && tg_.node_type(sink_node) == NodeType::SINK) {
+                    capture_edges_.edges.push_back(edge_id);
+                } else {
+                    delay_edges_.edges.push_back(edge_id);
+                }
+            }
+        }
+
+        //Delay lookups are forwarded to the wrapped calculator
+        Time max_edge_delay(const TimingGraph& tg, EdgeId edge_id) const override { return delay_calc_.max_edge_delay(tg, edge_id); }
+        Time min_edge_delay(const TimingGraph& tg, EdgeId edge_id) const override { return delay_calc_.min_edge_delay(tg, edge_id); }
+        Time setup_time(const TimingGraph& tg, EdgeId edge_id) const override { return delay_calc_.setup_time(tg, edge_id); }
+        Time hold_time(const TimingGraph& tg, EdgeId edge_id) const override { return delay_calc_.hold_time(tg, edge_id); }
+
+        void max_edge_delays(const TimingGraph& tg, edge_range edges, Time* delays) const override { delay_calc_.max_edge_delays(tg, edges, delays); }
+        void min_edge_delays(const TimingGraph& tg, edge_range edges, Time* delays) const override { delay_calc_.min_edge_delays(tg, edges, delays); }
+        void setup_times(const TimingGraph& tg, edge_range edges, Time* delays) const override { delay_calc_.setup_times(tg, edges, delays); }
+        void hold_times(const TimingGraph& tg, edge_range edges, Time* delays) const override { delay_calc_.hold_times(tg, edges, delays); }
+
+        ///Returns the edges whose delays have changed since the previous call, and records
+        ///their current delays. The first call returns every (enabled) edge.
+        ///
+        ///This should be called once before each timing update, and the returned edges
+        ///invalidated in every analyzer using the wrapped calculator (e.g. with
+        ///invalidate_changed_edges()).
+        const std::vector<EdgeId>& find_changed_edges() {
+            changed_edges_.clear();
+
+            find_changed_edges(delay_edges_, &DelayCalculator::max_edge_delays, &DelayCalculator::min_edge_delays);
+            find_changed_edges(capture_edges_, &DelayCalculator::setup_times, &DelayCalculator::hold_times);
+
+            has_snapshot_ = true;
+
+            return changed_edges_;
+        }
+
+        ///Returns the edges found by the last call to find_changed_edges()
+        const std::vector<EdgeId>& changed_edges() const {
+            TATUM_ASSERT_MSG(has_snapshot_, "find_changed_edges() must be called before changed_edges()");
+            return changed_edges_;
+        }
+
+        ///Invalidates the edges found by the last call to find_changed_edges() in analyzer,
+        ///returning the number of edges invalidated.
+        ///
+        ///This does not re-compare the delays, so may be called for each analyzer using
+        ///the wrapped calculator.
+        size_t invalidate_changed_edges(TimingAnalyzer& analyzer) const {
+            const std::vector<EdgeId>& edges = changed_edges();
+            analyzer.invalidate_edges(edges);
+            return edges.size();
+        }
+
+    private:
+        typedef void (DelayCalculator::*BatchLookup)(const TimingGraph&, edge_range, Time*) const;
+
+        //A set of edges and the two delays (e.g. max/min) of each edge recorded at the last call
+        //to find_changed_edges()
+        struct TrackedEdges {
+            std::vector<EdgeId> edges;
+            util::aligned_vector<Time> first;
+            util::aligned_vector<Time> second;
+
+            std::vector<char> changed;
+        };
+
+        constexpr static size_t BLOCK_SIZE = 256; //Edges compared at a time
+
+        void find_changed_edges(TrackedEdges& tracked, BatchLookup first_lookup, BatchLookup second_lookup) {
+            const size_t num_edges = tracked.edges.size();
+            if (!has_snapshot_) {
+                tracked.first.resize(num_edges);
+                tracked.second.resize(num_edges);
+                tracked.changed.resize(num_edges);
+            }
+
+            const size_t num_blocks = (num_edges + BLOCK_SIZE - 1) / BLOCK_SIZE;
+#ifdef TATUM_USE_TBB
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, num_blocks), [&](const tbb::blocked_range<size_t>& blocks) {
+                for (size_t iblock = blocks.begin(); iblock != blocks.end(); ++iblock) {
+                    compare_block(tracked, iblock, first_lookup, second_lookup);
+                }
+            });
+#else
+            for (size_t iblock = 0; iblock < num_blocks; ++iblock) {
+                compare_block(tracked, iblock, first_lookup, second_lookup);
+            }
+#endif
+
+            for (size_t i = 0; i < num_edges; ++i) {
+                if (tracked.changed[i]) {
+                    changed_edges_.push_back(tracked.edges[i]);
+                }
+            }
+        }
+
+        //Compares (and records) the current delays of the iblock'th block of tracked edges
+        void compare_block(TrackedEdges& tracked, size_t iblock, BatchLookup first_lookup, BatchLookup second_lookup) const {
+            const size_t begin = iblock * BLOCK_SIZE;
+            const size_t end = std::min(begin + BLOCK_SIZE, tracked.edges.size());
+            const size_t size = end - begin;
+            TATUM_ASSERT(size <= BLOCK_SIZE);
+
+            auto edges = tatum::util::make_range(tracked.edges.cbegin() + begin, tracked.edges.cbegin() + end);
+
+            Time first[BLOCK_SIZE];
+            Time second[BLOCK_SIZE];
+            (delay_calc_.*first_lookup)(tg_, edges, first);
+            (delay_calc_.*second_lookup)(tg_, edges, second);
+
+            Time* prev_first = tracked.first.data() + begin;
+            Time* prev_second = tracked.second.data() + begin;
+            char* changed = tracked.changed.data() + begin;
+
+            //Branch-free so the comparisons are vectorized
+            const char all_changed = !has_snapshot_;
+            for (size_t i = 0; i < size; ++i) {
+                changed[i] = all_changed | !same(first[i], prev_first[i]) | !same(second[i], prev_second[i]);
+                prev_first[i] = first[i];
+                prev_second[i] = second[i];
+            }
+        }
+
+        //Returns true if lhs and rhs are the same time (including both being invalid).
+        //A multi-corner time invalid in only some corners is conservatively treated as changed.
+        static bool same(const Time lhs, const Time rhs) {
+            return (lhs == rhs) | (!lhs.valid() & !rhs.valid());
+        }
+
+    private:
+        const TimingGraph& tg_;
+        const DelayCalculator& delay_calc_;
+
+        TrackedEdges delay_edges_; //Edges whose max/min delays are used
+        TrackedEdges capture_edges_; //Clock capture edges, whose setup/hold times are used
+
+        bool has_snapshot_ = false;
+        std::vector<EdgeId> changed_edges_;
+};
+
+} //namepsace
@@ -1,6 +1,8 @@
 #pragma once
+#include <memory>
 #include "tatum/tags/TimingTags.hpp"
-#include "tatum/TimingGraphFwd.hpp"
+#include "tatum/TimingGraph.hpp"
+#include "tatum/base/TimingDerate.hpp"
 #include "tatum/util/tatum_linear_map.hpp"
 
 namespace tatum { namespace detail {
@@ -55,6 +57,14 @@ class CommonAnalysisOps {
             return node_tags_[node].set_tag(tag);
         }
 
+        TimingTags::iterator remove_tag(const NodeId node, TimingTags::iterator iter) {
+            return node_tags_[node].remove_tag(iter);
+        }
+
+        TimingTags::iterator remove_slack_tag(const NodeId node, TimingTags::iterator iter) {
+            return node_slacks_[node].remove_tag(iter);
+        }
+
         void reset_node(const NodeId node) { 
             node_tags_[node].clear();
             node_slacks_[node].clear();
@@ -88,8 +98,86 @@ class CommonAnalysisOps {
             return Time(std::numeric_limits<float>::infinity());
         }
 
+        ///Sets the OCV derating applied to edge delays (see TimingDerate)
+        void set_timing_derate(const TimingGraph& tg, const TimingDerate& derate) {
+            derate_ = derate;
+            derate_enabled_ = derate.enabled();
+
+            edge_depths_.clear();
+            if (derate_enabled_ && derate.depth_based()) {
+                edge_depths_ = calculate_edge_depths(tg);
+            }
+        }
+
+        /*
+         * Re-allocates all tags into a single contiguous block of memory, with each
+         * node's tags sized to exactly fit its current number of tags.
+         *
+         * This is intended to be called once a full analysis has determined how many
+         * tags each node needs. It replaces the per-node allocations (and their growth
+         * slack) with one allocation, reducing memory usage and fragmentation, and laying
+         * out the tags in node order for better locality during traversals. Since later
+         * updates only reset or remove tags, nodes keep their packed storage; any
+         * node which later needs extra tags moves back to its own heap allocation.
+         *
+         * Must not be called concurrently with any other operation.
+         */
+        void pack_tags() {
+            size_t num_tags = 0;
+            for (const TimingTags& tags : node_tags_) num_tags += tags.size();
+            for (const TimingTags& tags : node_slacks_) num_tags += tags.size();
+#ifdef TATUM_CALCULATE_EDGE_SLACKS
+            for (const TimingTags& tags : edge_slacks_) num_tags += tags.size();
+#endif
+
+            //Note that the tags may currently be stored in tag_arena_, so
+            //we only release it once they have all been relocated
+            std::unique_ptr<TimingTag[]> new_tag_arena(num_tags ? new TimingTag[num_tags] : nullptr);
+
+            size_t offset = 0;
+            auto relocate = [&](TimingTags& tags) {
+                size_t size = tags.size();
+                tags.relocate(new_tag_arena.get() + offset, size);
+                offset += size;
+            };
+            for (TimingTags& tags : node_tags_) relocate(tags);
+            for (TimingTags& tags : node_slacks_) relocate(tags);
+#ifdef TATUM_CALCULATE_EDGE_SLACKS
+            for (TimingTags& tags : edge_slacks_) relocate(tags);
+#endif
+            TATUM_ASSERT(offset == num_tags);
+
+            tag_arena_ = std::move(new_tag_arena);
+        }
+
+
+    protected:
+        //Returns delay derated as part of a data path
+        Time derate_data_edge(const Time delay, const EdgeId edge, const ArrivalType arrival) const {
+            if (!derate_enabled_) return delay;
+            return derated(delay, edge, DeratePath::DATA, arrival);
+        }
+
+        //Returns delay derated as part of a clock path. Clock launch (clock-to-q)
+        //edges are derated as part of the data path they launch.
+        Time derate_clock_edge(const TimingGraph& tg, const Time delay, const EdgeId edge, const ArrivalType arrival) const {
+            if (!derate_enabled_) return delay;
+
+            DeratePath path = (tg.edge_type(edge) == EdgeType::PRIMITIVE_CLOCK_LAUNCH) ? DeratePath::DATA : DeratePath::CLOCK;
+            return derated(delay, edge, path, arrival);
+        }
+
+    private:
+        Time derated(const Time delay, const EdgeId edge, const DeratePath path, const ArrivalType arrival) const {
+            size_t depth = edge_depths_.empty() ? 0 : edge_depths_[edge];
+            return delay * derate_.factor(path, arrival, depth);
+        }
 
     protected:
+        //Shared storage for packed tags (see pack_tags()).
+        //Note that this is declared first so it is destroyed last
+        std::unique_ptr<TimingTag[]> tag_arena_;
+
         tatum::util::linear_map<NodeId,TimingTags> node_tags_;
 
 #ifdef TATUM_CALCULATE_EDGE_SLACKS
@@ -97,6 +185,12 @@ class CommonAnalysisOps {
 #endif
 
         tatum::util::linear_map<NodeId,TimingTags> node_slacks_;
+
+    private:
+        //OCV derating (only applied if derate_enabled_)
+        TimingDerate derate_;
+        bool derate_enabled_ = false;
+        tatum::util::linear_map<EdgeId,size_t> edge_depths_; //Empty unless derating is depth-based
 };
 
 }} //namespace
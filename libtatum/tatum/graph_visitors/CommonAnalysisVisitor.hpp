@@ -1,11 +1,19 @@
 #ifndef TATUM_COMMON_ANALYSIS_VISITOR_HPP
 #define TATUM_COMMON_ANALYSIS_VISITOR_HPP
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 #include "tatum/error.hpp"
 #include "tatum/TimingGraph.hpp"
 #include "tatum/TimingConstraints.hpp"
 #include "tatum/tags/TimingTags.hpp"
 #include "tatum/delay_calc/DelayCalculator.hpp"
 #include "tatum/graph_visitors/GraphVisitor.hpp"
+#include "tatum/graph_visitors/CommonClockIndex.hpp"
+#include "tatum/util/tatum_cpu_dispatch.hpp"
+#include "tatum/util/tatum_aligned_alloc.hpp"
 
 namespace tatum { namespace detail {
 
@@ -22,11 +30,16 @@ namespace tatum { namespace detail {
  * \see GraphVisitor
  *
  * \tparam AnalysisOps a class defining the setup/hold specific operations
+ * \tparam DelayCalc the type of the delay calculator. The delay calculator passed to the
+ *                   traversals must be (derived from) this type. Specifying the concrete 
+ *                   calculator type (rather than the DelayCalculator interface) allows delay 
+ *                   lookups to be inlined (provided the calculator, or its delay methods, are final)
  * \see SetupAnalysisOps
  * \see HoldAnalysisOps
  */
-template<class AnalysisOps>
+template<class AnalysisOps, class DelayCalc=DelayCalculator>
 class CommonAnalysisVisitor : public GraphVisitor {
+        static_assert(std::is_base_of<DelayCalculator,DelayCalc>::value, "DelayCalc must implement DelayCalculator");
     public:
         CommonAnalysisVisitor(size_t num_tags, size_t num_slacks)
             : ops_(num_tags, num_slacks) { }
@@ -53,17 +66,49 @@ class CommonAnalysisVisitor : public GraphVisitor {
 
         bool do_slack_traverse_node(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node) override;
 
+        ///Packs the tags into contiguous storage (see CommonAnalysisOps::pack_tags())
+        void pack_tags() { ops_.pack_tags(); }
+
+        ///Enables/disables the pruning of dominated data arrival tags (see prune_dominated_arrival_tags()).
+        ///The dominance bounds are calculated from tc when enabled, so this should be called again if
+        ///the clock constraints change.
+        void set_dominated_tag_pruning(const TimingConstraints& tc, bool enable);
+
+        ///Sets the slack threshold above which exact required times and slacks are not calculated
+        ///(see calculate_slack_bound()). An invalid threshold calculates them exactly everywhere.
+        void set_slack_threshold(const Time threshold, size_t num_nodes);
+
+        ///Sets the OCV derating applied to edge delays (see TimingDerate)
+        void set_timing_derate(const TimingGraph& tg, const TimingDerate& derate) { ops_.set_timing_derate(tg, derate); }
+
+        ///Sets the index used for common clock pessimism removal (see common_clock_credit()).
+        ///A null index disables it.
+        void set_common_clock_index(std::shared_ptr<const CommonClockIndex> index) { common_clock_index_ = std::move(index); }
+
     protected:
         AnalysisOps ops_;
 
     private:
-        bool do_arrival_traverse_edge(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id, const EdgeId edge_id);
+        //The edge traversals perform the bulk of the Time/tag operations, so are 
+        //compiled for multiple instruction sets (see TATUM_TARGET_CLONES)
+        //(edge_delay is the edge's delay, looked up for all of the node's edges by AnalysisOps::edge_delays())
+        bool do_arrival_traverse_edge(const TimingGraph& tg, const TimingConstraints& tc, const NodeId node_id, const EdgeId edge_id, const Time& edge_delay);
+
+        bool do_required_traverse_edge(const TimingGraph& tg, const NodeId node_id, const EdgeId edge_id, const Time& edge_delay);
+
+        bool do_slack_traverse_edge(const TimingGraph& tg, const DelayCalc& dc, const EdgeId edge);
 
-        bool do_required_traverse_edge(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node_id, const EdgeId edge_id);
+        bool mark_sink_required_times(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalc& dc, const NodeId node);
+        Time common_clock_credit(const TimingConstraints& tc, const NodeId sink, const DomainId launch_domain, const DomainId capture_domain);
 
-        bool do_slack_traverse_edge(const TimingGraph& tg, const DelayCalculator& dc, const EdgeId edge);
+        bool prune_dominated_arrival_tags(const NodeId node);
+        bool is_dominated(const TimingTag& tag, const TimingTag& other_tag);
+        bool remove_invalid_slack_tags(const NodeId node);
 
-        bool mark_sink_required_times(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node);
+        bool update_slack_bounds(const TimingGraph& tg, const NodeId node);
+        Time calculate_slack_bound(const TimingGraph& tg, const NodeId node);
+        Time calculate_unpropagated_slack_bound(const TimingGraph& tg, const NodeId node) const;
+        bool mark_bounded_slacks(const NodeId node);
 
         bool should_propagate_clocks(const TimingGraph& tg, const TimingConstraints& tc, const EdgeId edge_id) const;
         bool should_propagate_clock_launch_tags(const TimingGraph& tg, const EdgeId edge_id) const;
@@ -73,14 +118,330 @@ class CommonAnalysisVisitor : public GraphVisitor {
 
         bool is_clock_data_launch_edge(const TimingGraph& tg, const EdgeId edge_id) const;
         bool is_clock_data_capture_edge(const TimingGraph& tg, const EdgeId edge_id) const;
+
+        static Time* edge_delay_buffer(size_t num_edges);
+
+    private:
+        //Lower bounds on the difference in endpoint slack between the data arrival tags of two
+        //launch domains, indexed by [dominated_domain * num_dominance_domains_ + other_domain].
+        //Empty if pruning is disabled.
+        util::aligned_vector<Time> dominance_bounds_;
+        size_t num_dominance_domains_ = 0;
+
+        //Slacks above the threshold need not be exact (invalid if all slacks are exact)
+        Time slack_threshold_;
+
+        //Lower bound on the slack of every path through each node (only if slack_threshold_ is valid)
+        tatum::util::linear_map<NodeId,Time> node_slack_bounds_;
+
+        //Lower bound on the slack of the paths through each node whose required times 
+        //were not propagated to it (only if slack_threshold_ is valid)
+        tatum::util::linear_map<NodeId,Time> node_unpropagated_slack_bounds_;
+
+        //Common clock nodes for pessimism removal (null if disabled)
+        std::shared_ptr<const CommonClockIndex> common_clock_index_;
 };
 
+/*
+ * Dominated tag pruning
+ *
+ * Consider the data arrival tags of launch domains L and L' at a node n, and any downstream
+ * endpoint e which captures paths from L in domain C. Since both tags propagate along the same
+ * paths from n, and the required times of (L, C) and (L', C) at e differ only by their clock
+ * constraints and uncertainties (K), the slack at e of L's paths through n is at least:
+ *
+ *      slack_L'(e) + calculate_slack(K(L, C) - K(L', C), 0) + calculate_slack(0, arr_L(n) - arr_L'(n))
+ *
+ * where slack_L'(e) is the slack of (L', C) at e. The dominance bound of (L, L') is the minimum of
+ * the constraint term over all C analyzed for L. If the bound plus the arrival time term is
+ * non-negative, L's paths through n can never be more critical than those of L' (at any endpoint), and so
+ * L's tag can be removed without changing the worst slack of any endpoint. This bounds the number of
+ * tags at each node (and hence memory and run-time) when many clock domains interact.
+ *
+ * The bound only holds if every capture domain of L is also analyzed (with default constraints) for
+ * L', and neither pair has per-capture node constraints; otherwise L is never dominated by L'.
+ *
+ * Since removed tags no longer reach downstream nodes, the slacks (and per domain pair results, and
+ * timing reports) at other nodes may be optimistic or missing; only the worst slack of each endpoint
+ * (and hence WNS and endpoint based TNS) is exact.
+ */
+template<class AnalysisOps, class DelayCalc>
+void CommonAnalysisVisitor<AnalysisOps,DelayCalc>::set_dominated_tag_pruning(const TimingConstraints& tc, bool enable) {
+    dominance_bounds_.clear();
+    num_dominance_domains_ = 0;
+
+    if (!enable) return;
+
+    const size_t num_domains = tc.clock_domains().size();
+
+    //Domain pairs with constraints at specific capture nodes, which may make a per-node
+    //adjustment to the required time (or enable the analysis of otherwise unanalyzed pairs).
+    //Note that should_analyze() considers both setup and hold constraints.
+    std::vector<bool> has_capture_node_constraint(num_domains * num_domains, false);
+    for (auto constraints : {tc.setup_constraints(), tc.hold_constraints()}) {
+        for (const auto& kv : constraints) {
+            const NodeDomainPair& node_domain_pair = kv.first;
+            if (!node_domain_pair.capture_node) continue;
+
+            size_t src_index = size_t(node_domain_pair.domain_pair.src_domain_id);
+            size_t sink_index = size_t(node_domain_pair.domain_pair.sink_domain_id);
+            has_capture_node_constraint[src_index * num_domains + sink_index] = true;
+        }
+    }
+
+    const Time no_bound(-std::numeric_limits<float>::infinity());
+
+    dominance_bounds_.resize(num_domains * num_domains, no_bound);
+    for (DomainId domain : tc.clock_domains()) {
+        for (DomainId other_domain : tc.clock_domains()) {
+            if (domain == other_domain) continue;
+
+            Time bound(std::numeric_limits<float>::infinity());
+            for (DomainId capture_domain : tc.clock_domains()) {
+                bool domain_has_node_constraint = has_capture_node_constraint[size_t(domain) * num_domains + size_t(capture_domain)];
+                bool other_has_node_constraint = has_capture_node_constraint[size_t(other_domain) * num_domains + size_t(capture_domain)];
+
+                if (!domain_has_node_constraint && !tc.should_analyze(domain, capture_domain)) continue; //Never captured
+
+                if (   domain_has_node_constraint
+                    || other_has_node_constraint
+                    || !tc.should_analyze(other_domain, capture_domain)) {
+                    bound = no_bound;
+                    break;
+                }
+
+                Time constraint = ops_.clock_constraint(tc, domain, capture_domain) + ops_.clock_uncertainty(tc, domain, capture_domain);
+                Time other_constraint = ops_.clock_constraint(tc, other_domain, capture_domain) + ops_.clock_uncertainty(tc, other_domain, capture_domain);
+
+                Time constraint_slack = ops_.calculate_slack(constraint - other_constraint, Time(0.));
+                if (!constraint_slack.valid()) {
+                    //Unspecified constraint
+                    bound = no_bound;
+                    break;
+                }
+                bound.min(constraint_slack);
+            }
+
+            dominance_bounds_[size_t(domain) * num_domains + size_t(other_domain)] = bound;
+        }
+    }
+    num_dominance_domains_ = num_domains;
+}
+
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::prune_dominated_arrival_tags(const NodeId node) {
+    bool modified = false;
+
+    size_t itag = 0;
+    while (itag < ops_.get_tags(node, TagType::DATA_ARRIVAL).size()) {
+        auto arr_tags = ops_.get_mutable_tags(node, TagType::DATA_ARRIVAL);
+        auto tag_iter = arr_tags.begin() + itag;
+
+        //Note that tags are removed one at a time, so a tag is only ever removed if
+        //the tag dominating it remains
+        bool dominated = false;
+        for (const TimingTag& other_tag : arr_tags) {
+            if (&other_tag == &*tag_iter) continue;
+
+            if (is_dominated(*tag_iter, other_tag)) {
+                dominated = true;
+                break;
+            }
+        }
+
+        if (dominated) {
+            ops_.remove_tag(node, tag_iter);
+            modified = true;
+        } else {
+            ++itag;
+        }
+    }
+
+    return modified;
+}
+
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::is_dominated(const TimingTag& tag, const TimingTag& other_tag) {
+    DomainId domain = tag.launch_clock_domain();
+    DomainId other_domain = other_tag.launch_clock_domain();
+
+    //Constant generator tags have no launch domain
+    if (!domain || !other_domain) return false;
+
+    if (size_t(domain) >= num_dominance_domains_ || size_t(other_domain) >= num_dominance_domains_) return false; //Unknown domain
+
+    Time bound = dominance_bounds_[size_t(domain) * num_dominance_domains_ + size_t(other_domain)];
+
+    Time min_slack_diff = bound + ops_.calculate_slack(Time(0.), tag.time() - other_tag.time());
+
+    //Note that invalid (NaN) differences are never dominated, and with multiple
+    //timing corners the tag must be dominated in every corner
+    return min_slack_diff.min_value() >= 0.;
+}
+
+/*
+ * Slack threshold bounding
+ *
+ * Since a node's arrival time plus the delay of any of its out-going edges is no later (setup)
+ * or earlier (hold) than the arrival time at the edge's sink, the slack of any path through a
+ * node is at least the minimum slack at its fanout nodes. Hence the worst slack of the endpoints
+ * in a node's transitive fanout is a lower bound on every slack at the node. These bounds are
+ * calculated in the required time traversal (from the exact slacks of the endpoints, whose
+ * required times are set during the arrival traversal).
+ *
+ * If a node's bound exceeds the slack threshold its required times are not propagated at all
+ * (which is where run-time is saved when most of the design easily meets timing). As a result
+ * the required times of its fanin nodes miss the contribution of the paths through it, so for
+ * each node we also track the smallest bound of any such cut-off node in its transitive fanout
+ * (the 'unpropagated' bound). A node's slacks are limited to its unpropagated bound, and any 
+ * launch domain without a slack (e.g. at a cut-off node) is given one (with an unspecified 
+ * capture domain) set to the unpropagated bound.
+ *
+ * Since every node along a path with slack no larger than the threshold is analyzed normally,
+ * slacks no larger than the threshold (and all endpoint slacks) are exact, while larger slacks
+ * are only lower bounds which still exceed the threshold (and may not be reported per capture
+ * domain). Required times are only exact where the slack is within the threshold.
+ */
+template<class AnalysisOps, class DelayCalc>
+void CommonAnalysisVisitor<AnalysisOps,DelayCalc>::set_slack_threshold(const Time threshold, size_t num_nodes) {
+    slack_threshold_ = threshold;
+
+    if (slack_threshold_.valid()) {
+        node_slack_bounds_ = tatum::util::linear_map<NodeId,Time>(num_nodes, Time(std::numeric_limits<float>::infinity()));
+        node_unpropagated_slack_bounds_ = tatum::util::linear_map<NodeId,Time>(num_nodes, Time(std::numeric_limits<float>::infinity()));
+    } else {
+        node_slack_bounds_ = tatum::util::linear_map<NodeId,Time>();
+        node_unpropagated_slack_bounds_ = tatum::util::linear_map<NodeId,Time>();
+    }
+}
+
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::update_slack_bounds(const TimingGraph& tg, const NodeId node) {
+    //Returns true if the node's required times should be cut-off
+    Time bound = calculate_slack_bound(tg, node);
+    node_slack_bounds_[node] = bound;
+
+    //Endpoint required times are set during the arrival traversal, so are never cut-off
+    //(with multiple timing corners the bound must exceed the threshold in every corner)
+    bool cut_off = tg.node_type(node) != NodeType::SINK && bound.min_value() > slack_threshold_.value();
+
+    if (cut_off) {
+        node_unpropagated_slack_bounds_[node] = bound;
+    } else {
+        node_unpropagated_slack_bounds_[node] = calculate_unpropagated_slack_bound(tg, node);
+    }
+
+    return cut_off;
+}
+
+template<class AnalysisOps, class DelayCalc>
+Time CommonAnalysisVisitor<AnalysisOps,DelayCalc>::calculate_slack_bound(const TimingGraph& tg, const NodeId node) {
+    Time bound(std::numeric_limits<float>::infinity()); //Unconstrained
+
+    if (tg.node_type(node) == NodeType::SINK) {
+        //The endpoint's required times are known, so use its exact (worst) slack
+        for(const TimingTag& arr_tag : ops_.get_tags(node, TagType::DATA_ARRIVAL)) {
+            for(const TimingTag& req_tag : ops_.get_tags(node, TagType::DATA_REQUIRED)) {
+                if(!should_calculate_slack(arr_tag, req_tag)) continue;
+
+                Time slack = ops_.calculate_slack(req_tag.time(), arr_tag.time());
+                if (slack.valid()) {
+                    bound.min(slack);
+                }
+            }
+        }
+    } else {
+        for(EdgeId edge_id : tg.node_out_edges(node)) {
+            if(tg.edge_disabled(edge_id)) continue;
+
+            bound.min(node_slack_bounds_[tg.edge_sink_node(edge_id)]);
+        }
+    }
+
+    return bound;
+}
+
+template<class AnalysisOps, class DelayCalc>
+Time CommonAnalysisVisitor<AnalysisOps,DelayCalc>::calculate_unpropagated_slack_bound(const TimingGraph& tg, const NodeId node) const {
+    Time bound(std::numeric_limits<float>::infinity()); //All required times propagated
+
+    for(EdgeId edge_id : tg.node_out_edges(node)) {
+        if(tg.edge_disabled(edge_id)) continue;
+
+        bound.min(node_unpropagated_slack_bounds_[tg.edge_sink_node(edge_id)]);
+    }
+
+    return bound;
+}
+
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::mark_bounded_slacks(const NodeId node) {
+    bool modified = false;
+
+    const Time bound = node_unpropagated_slack_bounds_[node];
+    if (!(bound.min_value() < std::numeric_limits<float>::infinity())) return modified; //All required times propagated
+
+    //Paths whose required times were cut-off may have slack as small as the bound
+    for (TimingTag& slack_tag : ops_.get_mutable_slack_tags(node)) {
+        Time limited_slack = slack_tag.time();
+        limited_slack.min(bound);
+        if (limited_slack != slack_tag.time()) {
+            slack_tag.set_time(limited_slack);
+            modified = true;
+        }
+    }
+
+    //Launch domains with no slack had all their paths cut-off, so report the bound
+    for(const TimingTag& arr_tag : ops_.get_tags(node, TagType::DATA_ARRIVAL)) {
+        if(!arr_tag.launch_clock_domain()) continue; //Constant generator
+        if(!arr_tag.time().valid()) continue;
+
+        bool has_slack = false;
+        for (const TimingTag& slack_tag : ops_.get_node_slacks(node)) {
+            if (slack_tag.launch_clock_domain() == arr_tag.launch_clock_domain()) {
+                has_slack = true;
+                break;
+            }
+        }
+        if (has_slack) continue;
+
+        TimingTag bound_tag(bound, 
+                            arr_tag.launch_clock_domain(), 
+                            DomainId::INVALID(), //Any capture
+                            NodeId::INVALID(), //Origin
+                            TagType::SLACK);
+        modified |= ops_.merge_slack_tags(node, bound, bound_tag);
+    }
+
+    return modified;
+}
+
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::remove_invalid_slack_tags(const NodeId node) {
+    //During incremental updates the slack tags are reset (rather than cleared), so a node
+    //whose arrival tag has been pruned may be left with an invalid slack tag for its domain
+    bool modified = false;
+
+    auto slack_tags = ops_.get_mutable_slack_tags(node);
+    for (auto iter = slack_tags.begin(); iter != slack_tags.end(); ) {
+        if (iter->time() == ops_.invalid_slack_time()) {
+            iter = ops_.remove_slack_tag(node, iter);
+            slack_tags = ops_.get_mutable_slack_tags(node);
+            modified = true;
+        } else {
+            ++iter;
+        }
+    }
+
+    return modified;
+}
+
 /*
  * Pre-traversal
  */
 
-template<class AnalysisOps>
-void CommonAnalysisVisitor<AnalysisOps>::do_reset_node_arrival_tags(const NodeId node_id) {
+template<class AnalysisOps, class DelayCalc>
+void CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_reset_node_arrival_tags(const NodeId node_id) {
     for (TagType type : {TagType::CLOCK_LAUNCH, TagType::CLOCK_CAPTURE, TagType::DATA_ARRIVAL}) {
         for (TimingTag& tag : ops_.get_mutable_tags(node_id, type)) {
             tag.set_origin_node(NodeId::INVALID());        
@@ -89,8 +450,8 @@ void CommonAnalysisVisitor<AnalysisOps>::do_reset_node_arrival_tags(const NodeId
     }
 }
 
-template<class AnalysisOps>
-void CommonAnalysisVisitor<AnalysisOps>::do_reset_node_required_tags(const NodeId node_id) {
+template<class AnalysisOps, class DelayCalc>
+void CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_reset_node_required_tags(const NodeId node_id) {
     for (TagType type : {TagType::DATA_REQUIRED}) {
         for (TimingTag& tag : ops_.get_mutable_tags(node_id, type)) {
             tag.set_origin_node(NodeId::INVALID());        
@@ -99,8 +460,8 @@ void CommonAnalysisVisitor<AnalysisOps>::do_reset_node_required_tags(const NodeI
     }
 }
 
-template<class AnalysisOps>
-void CommonAnalysisVisitor<AnalysisOps>::do_reset_node_slack_tags(const NodeId node_id) {
+template<class AnalysisOps, class DelayCalc>
+void CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_reset_node_slack_tags(const NodeId node_id) {
     for (TimingTag& tag : ops_.get_mutable_slack_tags(node_id)) {
         tag.set_origin_node(NodeId::INVALID());        
         tag.set_time(ops_.invalid_slack_time());
@@ -108,32 +469,38 @@ void CommonAnalysisVisitor<AnalysisOps>::do_reset_node_slack_tags(const NodeId n
 }
 
 
-template<class AnalysisOps>
-void CommonAnalysisVisitor<AnalysisOps>::do_reset_node_arrival_tags_from_origin(const NodeId node_id, const NodeId origin) {
+template<class AnalysisOps, class DelayCalc>
+void CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_reset_node_arrival_tags_from_origin(const NodeId node_id, const NodeId origin) {
+#ifdef TATUM_NO_TAG_ORIGINS
+    //Tags don't track their origins, so conservatively reset them all
+    static_cast<void>(origin);
+    do_reset_node_arrival_tags(node_id);
+#else
     for (TagType type : {TagType::CLOCK_LAUNCH, TagType::CLOCK_CAPTURE, TagType::DATA_ARRIVAL}) {
         for (TimingTag& tag : ops_.get_mutable_tags(node_id, type)) {
-            if (tag.origin_node() == origin) {
-                tag.set_origin_node(NodeId::INVALID());        
-                tag.set_time(ops_.invalid_arrival_time());
-            }
+            tag.reset_from_origin(origin, ops_.invalid_arrival_time());
         }
     }
+#endif
 }
 
-template<class AnalysisOps>
-void CommonAnalysisVisitor<AnalysisOps>::do_reset_node_required_tags_from_origin(const NodeId node_id, const NodeId origin) {
+template<class AnalysisOps, class DelayCalc>
+void CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_reset_node_required_tags_from_origin(const NodeId node_id, const NodeId origin) {
+#ifdef TATUM_NO_TAG_ORIGINS
+    //Tags don't track their origins, so conservatively reset them all
+    static_cast<void>(origin);
+    do_reset_node_required_tags(node_id);
+#else
     for (TagType type : {TagType::DATA_REQUIRED}) {
         for (TimingTag& tag : ops_.get_mutable_tags(node_id, type)) {
-            if (tag.origin_node() == origin) {
-                tag.set_origin_node(NodeId::INVALID());        
-                tag.set_time(ops_.invalid_required_time());
-            }
+            tag.reset_from_origin(origin, ops_.invalid_required_time());
         }
     }
+#endif
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_pre_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const NodeId node_id) {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_arrival_pre_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const NodeId node_id) {
     //Logical Input
 
     //We expect this function to only be called on nodes in the first level of the timing graph
@@ -223,11 +590,12 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_pre_traverse_node(const Timi
             //No longer true for an incremental analyzer
             //TATUM_ASSERT_MSG(ops_.get_tags(node_id, TagType::DATA_ARRIVAL).size() == 0, "Primary input already has data tags");
 
-            auto input_constraints = ops_.input_constraints(tc, node_id);
-            if(!input_constraints.empty()) { //Some inputs may be unconstrained, so do not create tags for them
-
-                DomainId domain_id = tc.node_clock_domain(node_id);
-                TATUM_ASSERT(domain_id);
+            //Some inputs may be unconstrained, so do not create tags for them
+            //
+            //Note that the input's domain and constraint are direct look-ups in frozen constraints
+            DomainId domain_id = tc.node_clock_domain(node_id);
+            Time input_constraint = domain_id ? ops_.input_constraint(tc, node_id, domain_id) : std::numeric_limits<Time>::quiet_NaN();
+            if(input_constraint.valid()) {
 
                 //The external clock may have latency
                 Time launch_source_latency = ops_.launch_source_latency(tc, domain_id);
@@ -235,8 +603,6 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_pre_traverse_node(const Timi
                 //An input constraint means there is 'input_constraint' delay from when an external 
                 //signal is launched by its clock (external to the chip) until it arrives at the
                 //primary input
-                Time input_constraint = ops_.input_constraint(tc, node_id, domain_id);
-                TATUM_ASSERT(input_constraint.valid());
 
                 //Initialize a data tag based on input delay constraint
                 TimingTag input_tag = TimingTag(launch_source_latency + input_constraint, 
@@ -248,6 +614,9 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_pre_traverse_node(const Timi
                 ops_.merge_arr_tags(node_id, input_tag);
 
                 node_constrained = true;
+            } else {
+                //Only checked off the fast path: an input with constraints must have one in its domain
+                TATUM_ASSERT_MSG(ops_.input_constraints(tc, node_id).empty(), "Primary input has no input constraint for its clock domain");
             }
         }
     }
@@ -255,8 +624,8 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_pre_traverse_node(const Timi
     return node_constrained;
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::do_required_pre_traverse_node(const TimingGraph& tg, const TimingConstraints& /*tc*/, const NodeId node_id) {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_required_pre_traverse_node(const TimingGraph& tg, const TimingConstraints& /*tc*/, const NodeId node_id) {
 
     NodeType node_type = tg.node_type(node_id);
     TATUM_ASSERT(node_type == NodeType::SINK);
@@ -268,28 +637,43 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_required_pre_traverse_node(const Tim
  * Arrival Time Operations
  */
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, NodeId node_id) {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_arrival_traverse_node(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, NodeId node_id) {
+    const DelayCalc& delay_calc = static_cast<const DelayCalc&>(dc);
 
     bool node_modified = false;
 
+    //Look-up the delays of all the in-edges with a single call, rather than one per edge
+    auto in_edges = tg.node_in_edges(node_id);
+    Time* edge_delays = edge_delay_buffer(in_edges.size());
+    ops_.edge_delays(delay_calc, tg, in_edges, edge_delays);
+
     //Pull from upstream sources to current node
-    for(EdgeId edge_id : tg.node_in_edges(node_id)) {
+    for(EdgeId edge_id : in_edges) {
+        const Time& edge_delay = *edge_delays++;
 
         if(tg.edge_disabled(edge_id)) continue;
 
-        node_modified |= do_arrival_traverse_edge(tg, tc, dc, node_id, edge_id);
+        node_modified |= do_arrival_traverse_edge(tg, tc, node_id, edge_id, edge_delay);
+    }
+
+    if(!dominance_bounds_.empty() && !common_clock_index_) {
+        //Now that all the arrival times are known, remove any dominated tags
+        //(before they are propagated downstream, or used to set required times).
+        //Note that the dominance bounds do not account for common clock credits
+        node_modified |= prune_dominated_arrival_tags(node_id);
     }
 
     if(tg.node_type(node_id) == NodeType::SINK) {
-        node_modified |= mark_sink_required_times(tg, tc, dc, node_id);
+        node_modified |= mark_sink_required_times(tg, tc, delay_calc, node_id);
     }
 
     return node_modified;
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_edge(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id, const EdgeId edge_id) {
+template<class AnalysisOps, class DelayCalc>
+TATUM_TARGET_CLONES
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_arrival_traverse_edge(const TimingGraph& tg, const TimingConstraints& tc, const NodeId node_id, const EdgeId edge_id, const Time& edge_delay) {
     bool timing_modified = false;
 
     //Pulling values from upstream source node
@@ -307,15 +691,10 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_edge(const TimingGr
             TimingTags::tag_range src_launch_clk_tags = ops_.get_tags(src_node_id, TagType::CLOCK_LAUNCH);
 
             if(!src_launch_clk_tags.empty()) {
-                const Time clk_launch_edge_delay = ops_.launch_clock_edge_delay(dc, tg, edge_id);
-
-                for(const TimingTag& src_launch_clk_tag : src_launch_clk_tags) {
-                    //Standard propagation through the clock network
+                const Time clk_launch_edge_delay = ops_.launch_clock_edge_delay(tg, edge_delay, edge_id);
 
-                    Time new_arr = src_launch_clk_tag.time() + clk_launch_edge_delay;
-                    timing_modified |= ops_.merge_arr_tags(node_id, new_arr, src_node_id, src_launch_clk_tag);
-
-                }
+                //Standard propagation through the clock network
+                timing_modified |= ops_.merge_arr_tags(node_id, src_launch_clk_tags, clk_launch_edge_delay, src_node_id);
             }
         }
 
@@ -324,12 +703,10 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_edge(const TimingGr
             TimingTags::tag_range src_capture_clk_tags = ops_.get_tags(src_node_id, TagType::CLOCK_CAPTURE);
 
             if(!src_capture_clk_tags.empty()) {
-                const Time clk_capture_edge_delay = ops_.capture_clock_edge_delay(dc, tg, edge_id);
+                const Time clk_capture_edge_delay = ops_.capture_clock_edge_delay(tg, edge_delay, edge_id);
 
-                for(const TimingTag& src_capture_clk_tag : src_capture_clk_tags) {
-                    //Standard propagation through the clock network
-                    timing_modified |= ops_.merge_arr_tags(node_id, src_capture_clk_tag.time() + clk_capture_edge_delay, src_node_id, src_capture_clk_tag);
-                }
+                //Standard propagation through the clock network
+                timing_modified |= ops_.merge_arr_tags(node_id, src_capture_clk_tags, clk_capture_edge_delay, src_node_id);
             }
         }
     }
@@ -347,7 +724,7 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_edge(const TimingGr
 
         TimingTags::tag_range src_launch_clk_tags = ops_.get_tags(src_node_id, TagType::CLOCK_LAUNCH);
         if(!src_launch_clk_tags.empty()) {
-            const Time launch_edge_delay = ops_.launch_clock_edge_delay(dc, tg, edge_id);
+            const Time launch_edge_delay = ops_.launch_clock_edge_delay(tg, edge_delay, edge_id);
 
             for(const TimingTag& src_launch_clk_tag : src_launch_clk_tags) {
                 //Convert clock launch into data arrival
@@ -370,13 +747,10 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_edge(const TimingGr
 
         TimingTags::tag_range src_data_tags = ops_.get_tags(src_node_id, TagType::DATA_ARRIVAL);
         if(!src_data_tags.empty()) {
-            const Time edge_delay = ops_.data_edge_delay(dc, tg, edge_id);
-            TATUM_ASSERT_SAFE(edge_delay.valid());
+            const Time data_edge_delay = ops_.data_edge_delay(edge_delay, edge_id);
+            TATUM_ASSERT_SAFE(data_edge_delay.valid());
 
-            for(const TimingTag& src_data_tag : src_data_tags) {
-                Time new_arr = src_data_tag.time() + edge_delay;
-                timing_modified |= ops_.merge_arr_tags(node_id, new_arr, src_node_id, src_data_tag);
-            }
+            timing_modified |= ops_.merge_arr_tags(node_id, src_data_tags, data_edge_delay, src_node_id);
         }
     }
 
@@ -399,27 +773,41 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_edge(const TimingGr
  */
 
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::do_required_traverse_node(const TimingGraph& tg, const TimingConstraints& /*tc*/, const DelayCalculator& dc, const NodeId node_id) {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_required_traverse_node(const TimingGraph& tg, const TimingConstraints& /*tc*/, const DelayCalculator& dc, const NodeId node_id) {
+    const DelayCalc& delay_calc = static_cast<const DelayCalc&>(dc);
     bool node_modified = false; //For now, always assume modified
 
     //Don't propagate required times through the clock network
     if(tg.node_type(node_id) == NodeType::CPIN) return node_modified;
 
+    if(slack_threshold_.valid()) {
+        //Skip calculating exact required times if every path through 
+        //this node has more slack than the threshold
+        if(update_slack_bounds(tg, node_id)) return node_modified;
+    }
+
+
+    //Look-up the delays of all the out-edges with a single call, rather than one per edge
+    auto out_edges = tg.node_out_edges(node_id);
+    Time* edge_delays = edge_delay_buffer(out_edges.size());
+    ops_.edge_delays(delay_calc, tg, out_edges, edge_delays);
 
     //Pull from downstream sinks to current node
-    for(EdgeId edge_id : tg.node_out_edges(node_id)) {
+    for(EdgeId edge_id : out_edges) {
+        const Time& edge_delay = *edge_delays++;
 
         if(tg.edge_disabled(edge_id)) continue;
 
-        node_modified |= do_required_traverse_edge(tg, dc, node_id, edge_id);
+        node_modified |= do_required_traverse_edge(tg, node_id, edge_id, edge_delay);
     }
 
     return node_modified;
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::do_required_traverse_edge(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node_id, const EdgeId edge_id) {
+template<class AnalysisOps, class DelayCalc>
+TATUM_TARGET_CLONES
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_required_traverse_edge(const TimingGraph& tg, const NodeId node_id, const EdgeId edge_id, const Time& edge_delay) {
     bool timing_modified = false;
 
     //Pulling values from downstream sink node
@@ -428,26 +816,24 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_required_traverse_edge(const TimingG
     TimingTags::tag_range sink_data_tags = ops_.get_tags(sink_node_id, TagType::DATA_REQUIRED);
 
     if(!sink_data_tags.empty()) {
-        const Time& edge_delay = ops_.data_edge_delay(dc, tg, edge_id);
-        TATUM_ASSERT_SAFE(edge_delay.valid());
+        const Time data_edge_delay = ops_.data_edge_delay(edge_delay, edge_id);
+        TATUM_ASSERT_SAFE(data_edge_delay.valid());
 
-        for(const TimingTag& sink_tag : sink_data_tags) {
-            //We only propogate the required time if we have a valid matching arrival time
-            timing_modified |= ops_.merge_req_tags(node_id, sink_tag.time() - edge_delay, sink_node_id, sink_tag, true);
-        }
+        //We only propogate the required time if we have a valid matching arrival time
+        timing_modified |= ops_.merge_req_tags(node_id, sink_data_tags, -data_edge_delay, sink_node_id, true);
     }
 
     return timing_modified;
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::do_slack_traverse_node(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node) {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_slack_traverse_node(const TimingGraph& tg, const DelayCalculator& dc, const NodeId node) {
     bool timing_modified = false;
 
     //Calculate the slack for each edge
 #ifdef TATUM_CALCULATE_EDGE_SLACKS
     for(const EdgeId edge : tg.node_in_edges(node)) {
-        timing_modified |= do_slack_traverse_edge(tg, dc, edge);
+        timing_modified |= do_slack_traverse_edge(tg, static_cast<const DelayCalc&>(dc), edge);
     }
 #else
     //Avoid unused param warnings
@@ -466,11 +852,20 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_slack_traverse_node(const TimingGrap
         }
     }
 
+    if(slack_threshold_.valid()) {
+        timing_modified |= mark_bounded_slacks(node);
+    }
+
+    if(!dominance_bounds_.empty()) {
+        timing_modified |= remove_invalid_slack_tags(node);
+    }
+
     return timing_modified;
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::do_slack_traverse_edge(const TimingGraph& tg, const DelayCalculator& dc, const EdgeId edge) {
+template<class AnalysisOps, class DelayCalc>
+TATUM_TARGET_CLONES
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::do_slack_traverse_edge(const TimingGraph& tg, const DelayCalc& dc, const EdgeId edge) {
     bool timing_modified = false;
 
     NodeId src_node = tg.edge_src_node(edge);
@@ -502,8 +897,8 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_slack_traverse_edge(const TimingGrap
     return timing_modified;
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::mark_sink_required_times(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const NodeId node_id) {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::mark_sink_required_times(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalc& dc, const NodeId node_id) {
     //Mark the required times of the current sink node
     TATUM_ASSERT(tg.node_type(node_id) == NodeType::SINK);
     bool timing_modified = false;
@@ -538,12 +933,10 @@ bool CommonAnalysisVisitor<AnalysisOps>::mark_sink_required_times(const TimingGr
 
                 //We produce a fully specified capture clock tags (both launch and capture) so we only want 
                 //to consider the capture clock tag which matches the data launch domain
-                bool same_launch_domain = (data_launch_domain == clock_launch_domain);
+                if(data_launch_domain != clock_launch_domain) continue;
 
                 //We only want to analyze paths between domains where a valid constraint has been specified
-                bool valid_launch_capture_pair = tc.should_analyze(data_launch_domain, clock_capture_domain, node_id);
-
-                if(same_launch_domain && valid_launch_capture_pair) {
+                if(tc.should_analyze(data_launch_domain, clock_capture_domain, node_id)) {
 
                     //We only set a required time if the source domain actually reaches this sink
                     //domain.  This is indicated by the presence of an arrival tag (which should have
@@ -563,11 +956,17 @@ bool CommonAnalysisVisitor<AnalysisOps>::mark_sink_required_times(const TimingGr
                                     + capture_edge_delay         //CPIN to sink delay (Thld, or Tsu)
                                     + Time(clock_uncertainty);   //Clock period uncertainty
 
+                    if(common_clock_index_ && !is_const_gen_tag(node_data_arr_tag)) {
+                        //Remove the pessimism of the clock path shared by launch and capture
+                        req_time += common_clock_credit(tc, node_id, data_launch_domain, clock_capture_domain);
+                    }
+
                     TimingTag node_data_req_tag(req_time, 
                                                 data_launch_domain, 
                                                 clock_capture_domain, 
                                                 NodeId::INVALID(), //Origin
-                                                TagType::DATA_REQUIRED);
+                                                TagType::DATA_REQUIRED,
+                                                tc.domain_pair_id(data_launch_domain, clock_capture_domain));
 
                     timing_modified |= ops_.merge_req_tags(node_id, node_data_req_tag);
                 }
@@ -628,7 +1027,8 @@ bool CommonAnalysisVisitor<AnalysisOps>::mark_sink_required_times(const TimingGr
                                                     data_launch_domain, 
                                                     io_capture_domain, 
                                                     NodeId::INVALID(), //Origin
-                                                    TagType::DATA_REQUIRED);
+                                                    TagType::DATA_REQUIRED,
+                                                    tc.domain_pair_id(data_launch_domain, io_capture_domain));
 
                         timing_modified |= ops_.merge_req_tags(node_id, node_data_req_tag);
                     }
@@ -640,8 +1040,58 @@ bool CommonAnalysisVisitor<AnalysisOps>::mark_sink_required_times(const TimingGr
     return timing_modified;
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::should_propagate_clocks(const TimingGraph& tg, const TimingConstraints& tc, const EdgeId edge_id) const {
+/*
+ * Common clock pessimism removal
+ *
+ * The launch and capture clock paths of an endpoint may share a common portion of the clock
+ * network, ending at a common node n. Since the launch clock arrival is pessimistic in one direction
+ * (e.g. late for setup) and the capture clock in the other, the shared portion is counted
+ * as both early and late, which is physically impossible. The difference between the launch and
+ * capture clock arrivals at n (excluding the clock constraint) is this pessimism, and is credited
+ * back to the required time.
+ *
+ * The common node n is found with a CommonClockIndex, and is shared by every path launched from
+ * the same clock source which reaches the endpoint. The credit is therefore a block-based one:
+ * it is calculated once per endpoint and launch domain (rather than by re-tracing the clock
+ * paths of each timing path), and is never larger than the credit of any individual path.
+ * Credits are only given to paths launched and captured by the same clock domain.
+ */
+template<class AnalysisOps, class DelayCalc>
+Time CommonAnalysisVisitor<AnalysisOps,DelayCalc>::common_clock_credit(const TimingConstraints& tc, const NodeId sink, const DomainId launch_domain, const DomainId capture_domain) {
+    if(launch_domain != capture_domain) return Time(0.);
+
+    NodeId clock_source = tc.clock_domain_source_node(launch_domain);
+    if(!clock_source) return Time(0.); //Virtual clock
+
+    NodeId common_node = common_clock_index_->common_node(sink, clock_source);
+    if(!common_node) return Time(0.);
+
+    const TimingTag* launch_tag = nullptr;
+    for(const TimingTag& tag : ops_.get_tags(common_node, TagType::CLOCK_LAUNCH)) {
+        if(tag.launch_clock_domain() == launch_domain) {
+            launch_tag = &tag;
+            break;
+        }
+    }
+
+    const TimingTag* capture_tag = nullptr;
+    for(const TimingTag& tag : ops_.get_tags(common_node, TagType::CLOCK_CAPTURE)) {
+        if(tag.launch_clock_domain() == launch_domain && tag.capture_clock_domain() == capture_domain) {
+            capture_tag = &tag;
+            break;
+        }
+    }
+
+    if(!launch_tag || !capture_tag) return Time(0.);
+
+    //The capture tag includes the (default) clock constraint
+    Time capture_clock_arrival = capture_tag->time() - ops_.clock_constraint(tc, launch_domain, capture_domain);
+
+    return ops_.common_clock_credit(launch_tag->time(), capture_clock_arrival);
+}
+
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::should_propagate_clocks(const TimingGraph& tg, const TimingConstraints& tc, const EdgeId edge_id) const {
     //We want to propagate clock tags through the arbitrary nodes making up the clock network until 
     //we hit another source node (i.e. a FF's output source).
     //
@@ -663,36 +1113,47 @@ bool CommonAnalysisVisitor<AnalysisOps>::should_propagate_clocks(const TimingGra
     return false;
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::should_propagate_clock_launch_tags(const TimingGraph& tg, const EdgeId edge_id) const {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::should_propagate_clock_launch_tags(const TimingGraph& tg, const EdgeId edge_id) const {
     return !is_clock_data_capture_edge(tg, edge_id);
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::should_propagate_clock_capture_tags(const TimingGraph& tg, const EdgeId edge_id) const {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::should_propagate_clock_capture_tags(const TimingGraph& tg, const EdgeId edge_id) const {
     NodeId sink_node = tg.edge_sink_node(edge_id);
     return tg.node_type(sink_node) != NodeType::SINK;
 }
 
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::is_clock_data_launch_edge(const TimingGraph& tg, const EdgeId edge_id) const {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::is_clock_data_launch_edge(const TimingGraph& tg, const EdgeId edge_id) const {
     NodeId edge_src_node = tg.edge_src_node(edge_id);
     NodeId edge_sink_node = tg.edge_sink_node(edge_id);
 
     return (tg.node_type(edge_src_node) == NodeType::CPIN) && (tg.node_type(edge_sink_node) == NodeType::SOURCE);
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::is_clock_data_capture_edge(const TimingGraph& tg, const EdgeId edge_id) const {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::is_clock_data_capture_edge(const TimingGraph& tg, const EdgeId edge_id) const {
     NodeId edge_src_node = tg.edge_src_node(edge_id);
     NodeId edge_sink_node = tg.edge_sink_node(edge_id);
 
     return (tg.node_type(edge_src_node) == NodeType::CPIN) && (tg.node_type(edge_sink_node) == NodeType::SINK);
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::should_propagate_data(const TimingGraph& tg, const EdgeId edge_id) const {
+//Returns space for the delays of num_edges edges. The buffer is per-thread, since
+//parallel walkers may traverse several nodes at once.
+template<class AnalysisOps, class DelayCalc>
+Time* CommonAnalysisVisitor<AnalysisOps,DelayCalc>::edge_delay_buffer(size_t num_edges) {
+    static thread_local util::aligned_vector<Time> edge_delays;
+    if (edge_delays.size() < num_edges) {
+        edge_delays.resize(num_edges);
+    }
+    return edge_delays.data();
+}
+
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::should_propagate_data(const TimingGraph& tg, const EdgeId edge_id) const {
     //We want to propagate data tags unless then re-enter the clock network
     NodeId src_node_id = tg.edge_src_node(edge_id);
     NodeType src_node_type = tg.node_type(src_node_id);
@@ -703,8 +1164,8 @@ bool CommonAnalysisVisitor<AnalysisOps>::should_propagate_data(const TimingGraph
     return false;
 }
 
-template<class AnalysisOps>
-bool CommonAnalysisVisitor<AnalysisOps>::should_calculate_slack(const TimingTag& src_tag, const TimingTag& sink_tag) const {
+template<class AnalysisOps, class DelayCalc>
+bool CommonAnalysisVisitor<AnalysisOps,DelayCalc>::should_calculate_slack(const TimingTag& src_tag, const TimingTag& sink_tag) const {
     TATUM_ASSERT_SAFE(src_tag.type() == TagType::DATA_ARRIVAL && sink_tag.type() == TagType::DATA_REQUIRED);
 
     //NOTE: we do not need to check the constraints to determine whether this domain pair should be analyzed,
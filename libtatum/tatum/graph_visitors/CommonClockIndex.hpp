@@ -0,0 +1,320 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/TimingConstraints.hpp"
+#include "tatum/util/tatum_assert.hpp"
+#include "tatum/util/tatum_linear_map.hpp"
+
+namespace tatum {
+
+/**
+ * Identifies, for each clocked timing endpoint, the last clock network node shared by the
+ * clock paths which launch its data and the clock path which captures it. These common
+ * nodes are used for block-based common clock pessimism removal (see
+ * TimingAnalyzer::set_common_clock_pessimism_removal()).
+ *
+ * The clock network consists of the clock sources, and every (non SOURCE/SINK) node
+ * reached by the clock tags propagated from them. Each clock network node's parent in the
+ * clock tree is its immediate dominator: the deepest node through which *every* clock path
+ * reaching it passes. Since the graph is levelized this is simply the lowest common ancestor
+ * (LCA) of its clock network fan-in. The clock sources are children of a virtual root, which
+ * represents 'no common node'.
+ *
+ * An Euler tour of the tree, with a sparse table over the depths of its nodes, answers LCA
+ * queries in constant time. A single levelized pass then tracks, for each node and clock source,
+ * the LCA of the clock pins which launch data (through a clock launch edge) reaching the node.
+ * At each endpoint, the LCA of that node and the endpoint's capture clock pin is shared by the
+ * clock paths of every launch/capture pair from that clock source. Since it is common to all
+ * of the endpoint's launch points (not only the most critical one), the pessimism it removes
+ * never exceeds that of any individual path.
+ *
+ * Data launched by a primary input (whose clock is off-chip) has no common node with any clock
+ * network node.
+ *
+ * The index depends only on the graph structure (including disabled edges) and the clock
+ * sources, not on any delays, so it need only be rebuilt if those change.
+ */
+class CommonClockIndex {
+    public:
+        CommonClockIndex(const TimingGraph& tg, const TimingConstraints& tc) {
+            build_clock_tree(tg, tc);
+            build_lca_table();
+            build_endpoint_common_nodes(tg, tc);
+        }
+
+    public: //Accessors
+        ///Returns the common clock network node of the paths launched by clock_source and captured
+        ///at the specified endpoint (SINK), or NodeId::INVALID() if there is none.
+        NodeId common_node(const NodeId sink, const NodeId clock_source) const {
+            for (size_t i = sink_begin_[size_t(sink)]; i < sink_begin_[size_t(sink) + 1]; ++i) {
+                if (sink_common_nodes_[i].clock_source == clock_source) {
+                    return sink_common_nodes_[i].common_node;
+                }
+            }
+            return NodeId::INVALID();
+        }
+
+        ///Returns the deepest clock network node through which every clock path reaching
+        ///both node_a and node_b passes, or NodeId::INVALID() if there is none (e.g. either node
+        ///is not part of the clock network)
+        NodeId common_node_of(const NodeId node_a, const NodeId node_b) const {
+            int a = tree_index_[node_a];
+            int b = tree_index_[node_b];
+            if (a < 0 || b < 0) return NodeId::INVALID();
+
+            return tree_nodes_[lca(a, b)].node; //Virtual root's node is invalid
+        }
+
+    private:
+        enum : int { ROOT = 0 }; //Index of the virtual root
+
+        //A clock tree node
+        struct TreeNode {
+            NodeId node;
+            int parent;
+            int depth;
+        };
+
+        //The LCA of the clock pins launching data from a clock source
+        struct ClockSourceLca {
+            NodeId clock_source;
+            int lca;
+        };
+
+        struct SinkCommonNode {
+            NodeId clock_source;
+            NodeId common_node;
+        };
+
+    private:
+        void build_clock_tree(const TimingGraph& tg, const TimingConstraints& tc) {
+            tree_index_ = tatum::util::linear_map<NodeId,int>(tg.nodes().size(), -1);
+            tree_nodes_.push_back({NodeId::INVALID(), -1, 0});
+            node_clock_sources_.emplace_back();
+
+            //All of a node's fan-in is on earlier levels, so its dominator is known
+            for (LevelId level : tg.levels()) {
+                for (NodeId node : tg.level_nodes(level)) {
+                    NodeType node_type = tg.node_type(node);
+
+                    int parent = -1;
+                    std::vector<NodeId> clock_sources;
+                    if (tc.node_is_clock_source(node)) {
+                        parent = ROOT;
+                        clock_sources.push_back(node);
+                    } else if (node_type != NodeType::SOURCE && node_type != NodeType::SINK) {
+                        //Clock tags propagate along any edge not ending at a SOURCE/SINK
+                        for (EdgeId edge : tg.node_in_edges(node)) {
+                            if (tg.edge_disabled(edge)) continue;
+
+                            int src = tree_index_[tg.edge_src_node(edge)];
+                            if (src < 0) continue; //Not in clock network
+
+                            parent = (parent < 0) ? src : naive_lca(parent, src);
+
+                            for (NodeId clock_source : node_clock_sources_[src]) {
+                                if (std::find(clock_sources.begin(), clock_sources.end(), clock_source) == clock_sources.end()) {
+                                    clock_sources.push_back(clock_source);
+                                }
+                            }
+                        }
+                    }
+
+                    if (parent < 0) continue; //Not in clock network
+
+                    tree_index_[node] = tree_nodes_.size();
+                    tree_nodes_.push_back({node, parent, tree_nodes_[parent].depth + 1});
+                    node_clock_sources_.push_back(std::move(clock_sources));
+                }
+            }
+        }
+
+        //LCA by walking up the (partially built) tree, used only to build it
+        int naive_lca(int a, int b) const {
+            while (a != b) {
+                if (tree_nodes_[a].depth < tree_nodes_[b].depth) {
+                    std::swap(a, b);
+                }
+                a = tree_nodes_[a].parent;
+            }
+            return a;
+        }
+
+        void build_lca_table() {
+            //Children of each tree node (parents always preceed their children)
+            std::vector<size_t> child_begin(tree_nodes_.size() + 1, 0);
+            for (size_t i = 1; i < tree_nodes_.size(); ++i) {
+                ++child_begin[tree_nodes_[i].parent + 1];
+            }
+            for (size_t i = 1; i < child_begin.size(); ++i) {
+                child_begin[i] += child_begin[i - 1];
+            }
+            std::vector<int> children(tree_nodes_.size() - 1);
+            std::vector<size_t> next_child(child_begin.begin(), child_begin.end() - 1);
+            for (size_t i = 1; i < tree_nodes_.size(); ++i) {
+                children[next_child[tree_nodes_[i].parent]++] = i;
+            }
+
+            //Euler tour (iterative, since clock trees may be deep)
+            euler_first_.resize(tree_nodes_.size());
+            euler_tour_.reserve(2 * tree_nodes_.size() - 1);
+
+            std::vector<std::pair<int,size_t>> stack; //Node and next child index
+            stack.push_back({ROOT, child_begin[ROOT]});
+            euler_first_[ROOT] = 0;
+            euler_tour_.push_back(ROOT);
+            while (!stack.empty()) {
+                int node = stack.back().first;
+                size_t& ichild = stack.back().second;
+                if (ichild < child_begin[node + 1]) {
+                    int child = children[ichild++];
+                    euler_first_[child] = euler_tour_.size();
+                    euler_tour_.push_back(child);
+                    stack.emplace_back(child, child_begin[child]);
+                } else {
+                    stack.pop_back();
+                    if (!stack.empty()) {
+                        euler_tour_.push_back(stack.back().first);
+                    }
+                }
+            }
+            TATUM_ASSERT(euler_tour_.size() == 2 * tree_nodes_.size() - 1);
+
+            //Sparse table of the shallowest tour entry in each power-of-two length range
+            sparse_table_.push_back(euler_tour_);
+            for (size_t len = 2; len <= euler_tour_.size(); len *= 2) {
+                const std::vector<int>& prev = sparse_table_.back();
+                std::vector<int> row(euler_tour_.size() - len + 1);
+                for (size_t i = 0; i < row.size(); ++i) {
+                    row[i] = shallower(prev[i], prev[i + len / 2]);
+                }
+                sparse_table_.push_back(std::move(row));
+            }
+        }
+
+        //Constant time LCA
+        int lca(int a, int b) const {
+            size_t first = euler_first_[a];
+            size_t last = euler_first_[b];
+            if (first > last) std::swap(first, last);
+
+            size_t level = floor_log2(last - first + 1);
+            const std::vector<int>& row = sparse_table_[level];
+            return shallower(row[first], row[last + 1 - (size_t(1) << level)]);
+        }
+
+        int shallower(int a, int b) const {
+            return (tree_nodes_[a].depth <= tree_nodes_[b].depth) ? a : b;
+        }
+
+        static size_t floor_log2(size_t value) {
+            size_t log = 0;
+            while (value >>= 1) ++log;
+            return log;
+        }
+
+        void build_endpoint_common_nodes(const TimingGraph& tg, const TimingConstraints& tc) {
+            //LCA of the clock pins launching the data reaching each node, per clock source
+            tatum::util::linear_map<NodeId,std::vector<ClockSourceLca>> launch_lcas(tg.nodes().size());
+
+            auto merge = [&](std::vector<ClockSourceLca>& lcas, const ClockSourceLca& new_lca) {
+                for (ClockSourceLca& lca_entry : lcas) {
+                    if (lca_entry.clock_source == new_lca.clock_source) {
+                        lca_entry.lca = lca(lca_entry.lca, new_lca.lca);
+                        return;
+                    }
+                }
+                lcas.push_back(new_lca);
+            };
+
+            std::vector<std::pair<NodeId,SinkCommonNode>> sink_common_nodes; //In level order
+            for (LevelId level : tg.levels()) {
+                for (NodeId node : tg.level_nodes(level)) {
+                    std::vector<ClockSourceLca>& node_lcas = launch_lcas[node];
+                    NodeType node_type = tg.node_type(node);
+
+                    //Primary inputs are launched by an off-chip clock, which shares no on-chip clock path
+                    for (DelayType delay_type : {DelayType::MAX, DelayType::MIN}) {
+                        for (const auto& kv : tc.input_constraints(node, delay_type)) {
+                            NodeId clock_source = tc.clock_domain_source_node(kv.second.domain);
+                            if (clock_source) {
+                                merge(node_lcas, {clock_source, ROOT});
+                            }
+                        }
+                    }
+
+                    for (EdgeId edge : tg.node_in_edges(node)) {
+                        if (tg.edge_disabled(edge)) continue;
+
+                        NodeId src_node = tg.edge_src_node(edge);
+                        if (tg.node_type(src_node) == NodeType::CPIN) {
+                            //Data only leaves the clock network through clock launch edges
+                            int src = tree_index_[src_node];
+                            if (node_type != NodeType::SOURCE || src < 0) continue;
+
+                            for (NodeId clock_source : node_clock_sources_[src]) {
+                                merge(node_lcas, {clock_source, src});
+                            }
+                        } else {
+                            for (const ClockSourceLca& src_lca : launch_lcas[src_node]) {
+                                merge(node_lcas, src_lca);
+                            }
+                        }
+                    }
+
+                    if (node_type != NodeType::SINK) continue;
+
+                    EdgeId capture_edge = tg.node_clock_capture_edge(node);
+                    if (capture_edge) {
+                        int capture = tree_index_[tg.edge_src_node(capture_edge)];
+
+                        for (const ClockSourceLca& launch_lca : node_lcas) {
+                            if (capture < 0) break;
+
+                            int common = lca(launch_lca.lca, capture);
+                            if (common != ROOT) {
+                                sink_common_nodes.push_back({node, {launch_lca.clock_source, tree_nodes_[common].node}});
+                            }
+                        }
+                    }
+
+                    //Sinks have no fan-out
+                    node_lcas = std::vector<ClockSourceLca>();
+                }
+            }
+
+            //Index by sink
+            std::stable_sort(sink_common_nodes.begin(), sink_common_nodes.end(),
+                             [](const std::pair<NodeId,SinkCommonNode>& lhs, const std::pair<NodeId,SinkCommonNode>& rhs) {
+                                 return size_t(lhs.first) < size_t(rhs.first);
+                             });
+
+            sink_begin_.assign(tg.nodes().size() + 1, 0);
+            for (const auto& kv : sink_common_nodes) {
+                ++sink_begin_[size_t(kv.first) + 1];
+                sink_common_nodes_.push_back(kv.second);
+            }
+            for (size_t i = 1; i < sink_begin_.size(); ++i) {
+                sink_begin_[i] += sink_begin_[i - 1];
+            }
+        }
+
+    private:
+        //Clock tree (indexed by tree node, the first being the virtual root)
+        tatum::util::linear_map<NodeId,int> tree_index_; //Tree node of each timing graph node (-1 if not in clock network)
+        std::vector<TreeNode> tree_nodes_;
+        std::vector<std::vector<NodeId>> node_clock_sources_; //Clock sources reaching each tree node
+
+        //Euler tour of the clock tree, and sparse table for range-minimum (depth) queries over it
+        std::vector<int> euler_tour_;
+        std::vector<size_t> euler_first_; //First occurrence of each tree node in euler_tour_
+        std::vector<std::vector<int>> sparse_table_;
+
+        //Common nodes of each endpoint (per launching clock source), indexed by sink_begin_
+        std::vector<size_t> sink_begin_; //Indexed by node id
+        std::vector<SinkCommonNode> sink_common_nodes_;
+};
+
+} //namepsace
@@ -68,6 +68,10 @@ class HoldAnalysisOps : public CommonAnalysisOps {
             return node_tags_[node].max(time, origin, ref_tag, arrival_must_be_valid); 
         }
 
+        bool merge_req_tags(const NodeId node, TimingTags::tag_range ref_tags, const Time delay, const NodeId origin, bool arrival_must_be_valid=false) { 
+            return node_tags_[node].max(ref_tags, delay, origin, arrival_must_be_valid); 
+        }
+
         bool merge_arr_tags(const NodeId node, const TimingTag& ref_tag) { 
             return merge_arr_tags(node, ref_tag.time(), ref_tag.origin_node(), ref_tag);
         }
@@ -76,21 +80,44 @@ class HoldAnalysisOps : public CommonAnalysisOps {
             return node_tags_[node].min(time, origin, ref_tag); 
         }
 
-        Time data_edge_delay(const DelayCalculator& dc, const TimingGraph& tg, const EdgeId edge_id) { 
-            Time delay = dc.min_edge_delay(tg, edge_id);
+        bool merge_arr_tags(const NodeId node, TimingTags::tag_range ref_tags, const Time delay, const NodeId origin) { 
+            return node_tags_[node].min(ref_tags, delay, origin); 
+        }
+
+        ///Looks up the delays of a range of edges with a single call (see DelayCalculator), as
+        ///used by the data_edge_delay(), launch_clock_edge_delay() and capture_clock_edge_delay()
+        ///overloads which take an edge's delay
+        template<class DelayCalc>
+        void edge_delays(const DelayCalc& dc, const TimingGraph& tg, const TimingGraph::edge_range edges, Time* delays) {
+            dc.min_edge_delays(tg, edges, delays);
+        }
+
+        template<class DelayCalc>
+        Time data_edge_delay(const DelayCalc& dc, const TimingGraph& tg, const EdgeId edge_id) { 
+            return data_edge_delay(dc.min_edge_delay(tg, edge_id), edge_id);
+        }
+
+        Time data_edge_delay(const Time delay, const EdgeId edge_id) { 
             TATUM_ASSERT_MSG(delay.value() >= 0., "Data edge delay expected to be positive");
 
-            return delay; 
+            //Pessimistic hold analysis: data arrives early
+            return derate_data_edge(delay, edge_id, ArrivalType::EARLY); 
         }
 
-        Time launch_clock_edge_delay(const DelayCalculator& dc, const TimingGraph& tg, const EdgeId edge_id) { 
-            Time delay = dc.min_edge_delay(tg, edge_id);
+        template<class DelayCalc>
+        Time launch_clock_edge_delay(const DelayCalc& dc, const TimingGraph& tg, const EdgeId edge_id) { 
+            return launch_clock_edge_delay(tg, dc.min_edge_delay(tg, edge_id), edge_id);
+        }
+
+        Time launch_clock_edge_delay(const TimingGraph& tg, const Time delay, const EdgeId edge_id) { 
             TATUM_ASSERT_MSG(delay.value() >= 0., "Launch clock edge delay expected to be positive");
 
-            return delay;
+            //Pessimistic hold analysis: launch occurs early
+            return derate_clock_edge(tg, delay, edge_id, ArrivalType::EARLY);
         }
 
-        Time capture_clock_edge_delay(const DelayCalculator& dc, const TimingGraph& tg, const EdgeId edge_id) { 
+        template<class DelayCalc>
+        Time capture_clock_edge_delay(const DelayCalc& dc, const TimingGraph& tg, const EdgeId edge_id) { 
             NodeId src_node = tg.edge_src_node(edge_id);
             NodeId sink_node = tg.edge_sink_node(edge_id);
 
@@ -102,13 +129,19 @@ class HoldAnalysisOps : public CommonAnalysisOps {
                 //(instead of the data path).
                 return thld;
             } else {
-                Time tcq = dc.min_edge_delay(tg, edge_id);
-                TATUM_ASSERT_MSG(tcq.value() >= 0., "Clock-to-q delay (Tcq) expected to be positive");
-
-                return tcq; 
+                return capture_clock_edge_delay(tg, dc.min_edge_delay(tg, edge_id), edge_id);
             }
         }
 
+        ///Returns the delay of a clock capture path edge (other than a CPIN to SINK setup/hold
+        ///constraint edge), given the edge's delay
+        Time capture_clock_edge_delay(const TimingGraph& tg, const Time tcq, const EdgeId edge_id) { 
+            TATUM_ASSERT_MSG(tcq.value() >= 0., "Clock-to-q delay (Tcq) expected to be positive");
+
+            //Pessimistic hold analysis: capture occurs late
+            return derate_clock_edge(tg, tcq, edge_id, ArrivalType::LATE); 
+        }
+
         Time invalid_arrival_time() {
             return Time(std::numeric_limits<float>::infinity());
         }
@@ -123,6 +156,14 @@ class HoldAnalysisOps : public CommonAnalysisOps {
             //we we subtract the required time from the arrival time to get the hold slack
             return arrival_time - required_time;
         }
+
+        Time common_clock_credit(const Time launch_clock_arrival, const Time capture_clock_arrival) {
+            //Hold analysis treats the common clock path as early when launching and late when
+            //capturing. Reducing the required time by the difference recovers the pessimism
+            Time credit = launch_clock_arrival - capture_clock_arrival;
+            credit.min(Time(0.));
+            return credit;
+        }
 };
 
 }} //namespace
@@ -0,0 +1,131 @@
+#pragma once
+#include <atomic>
+#include "tatum/TimingGraph.hpp"
+#include "tatum/TimingConstraints.hpp"
+#include "tatum/graph_visitors/GraphVisitor.hpp"
+#include "tatum/util/tatum_linear_map.hpp"
+
+namespace tatum {
+
+/**
+ * Tracks which nodes of the timing graph form the (pure) clock network, so that
+ * full graph walkers can calculate the clock network's tags once and then skip
+ * it on later (data-only) updates.
+ *
+ * A node is part of the pure clock network if it is not a SOURCE or SINK, and
+ * all of its (enabled) fan-in comes from clock sources or other pure clock network
+ * nodes. Such nodes hold only clock launch/capture tags: they never receive data
+ * arrival tags (and hence also no required or slack tags), and their clock tags
+ * depend only on the delays of edges which feed the clock network.
+ *
+ * While the cache is valid a walker should neither reset nor traverse the clock
+ * network nodes, visiting only the nodes returned by nodes()/level_nodes().
+ * The cache is invalidated (until the next full arrival traversal) whenever an
+ * edge feeding the clock network is invalidated.
+ *
+ * Note that this relies on *all* delay changes being reported by invalidating the
+ * affected edges, which is why caching must be explicitly enabled.
+ */
+class ClockNetworkCache {
+    public:
+        typedef TimingGraph::node_range node_range;
+
+    public: //Accessors
+        ///Returns true if the clock network tags calculated by visitor are up-to-date,
+        ///and so the clock network can be skipped
+        bool valid(const GraphVisitor& visitor) const {
+            return enabled_ && valid_ && &visitor == cached_visitor_;
+        }
+
+        ///Returns true if caching is enabled
+        bool enabled() const { return enabled_; }
+
+        ///Returns all nodes which are not part of the clock network
+        node_range nodes() const {
+            return tatum::util::make_range(nodes_.cbegin(), nodes_.cend());
+        }
+
+        ///Returns the nodes in the specified level which are not part of the clock network
+        node_range level_nodes(const LevelId level) const {
+            return tatum::util::make_range(nodes_.cbegin() + level_begin_[size_t(level)],
+                                           nodes_.cbegin() + level_begin_[size_t(level) + 1]);
+        }
+
+    public: //Mutators
+        ///Enables/disables caching
+        void set_enabled(bool enable) {
+            enabled_ = enable;
+            valid_ = false;
+        }
+
+        ///Records that the specified edge has been invalidated
+        ///(may be called concurrently)
+        void invalidate_edge(const EdgeId edge) {
+            if (valid_.load(std::memory_order_relaxed) && edge_feeds_clock_network_[edge]) {
+                valid_.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        ///Records that visitor's clock network tags have been (fully) re-calculated
+        void mark_valid(const TimingGraph& tg, const TimingConstraints& tc, const GraphVisitor& visitor) {
+            if (!enabled_) return;
+
+            if (level_begin_.empty()) {
+                //Only need to identify the clock network once
+                build(tg, tc);
+            }
+
+            cached_visitor_ = &visitor;
+            valid_ = true;
+        }
+
+    private:
+        void build(const TimingGraph& tg, const TimingConstraints& tc) {
+            tatum::util::linear_map<NodeId,bool> is_clock_node(tg.nodes().size(), false);
+
+            //Since all of a node's fan-in is on earlier levels, a single levelized pass
+            //identifies the clock network
+            for (LevelId level : tg.levels()) {
+                level_begin_.push_back(nodes_.size());
+
+                for (NodeId node : tg.level_nodes(level)) {
+                    bool clock_node = false;
+
+                    NodeType node_type = tg.node_type(node);
+                    if (node_type != NodeType::SOURCE && node_type != NodeType::SINK) {
+                        for (EdgeId edge : tg.node_in_edges(node)) {
+                            if (tg.edge_disabled(edge)) continue;
+
+                            NodeId src_node = tg.edge_src_node(edge);
+                            clock_node = is_clock_node[src_node] || tc.node_is_clock_source(src_node);
+
+                            if (!clock_node) break;
+                        }
+                    }
+
+                    if (clock_node) {
+                        is_clock_node[node] = true;
+                    } else {
+                        nodes_.push_back(node);
+                    }
+                }
+            }
+            level_begin_.push_back(nodes_.size());
+
+            edge_feeds_clock_network_ = tatum::util::linear_map<EdgeId,bool>(tg.edges().size(), false);
+            for (EdgeId edge : tg.edges()) {
+                edge_feeds_clock_network_[edge] = is_clock_node[tg.edge_sink_node(edge)];
+            }
+        }
+
+    private:
+        bool enabled_ = false;
+        std::atomic<bool> valid_{false};
+        const GraphVisitor* cached_visitor_ = nullptr; //The visitor whose clock tags are cached
+
+        std::vector<NodeId> nodes_; //Non-clock network nodes, ordered by level
+        std::vector<size_t> level_begin_; //Index of each level's first node in nodes_
+        tatum::util::linear_map<EdgeId,bool> edge_feeds_clock_network_;
+};
+
+} //namepsace
@@ -1,5 +1,6 @@
 #pragma once
 #include "tatum/graph_walkers/TimingGraphWalker.hpp"
+#include "tatum/graph_walkers/ClockNetworkCache.hpp"
 #include "tatum/graph_visitors/GraphVisitor.hpp"
 #include "tatum/TimingGraph.hpp"
 
@@ -15,17 +16,35 @@ namespace tatum {
  * manner.  However nodes within each level are processed in parallel using
  * Thread Building Blocks (TBB). If TBB is not available it operates serially and is 
  * equivalent to the SerialWalker.
+ *
+ * If clock network caching is enabled the clock network is only traversed when
+ * one of its edges has been invalidated (see ClockNetworkCache).
  */
 class ParallelLevelizedWalker : public TimingGraphWalker {
     public:
-        void invalidate_edge_impl(const EdgeId /*edge*/) override {
-            //Do nothing, this walker only does full updates
+        void invalidate_edge_impl(const EdgeId edge) override {
+            //This walker only does full updates, but needs to know if the clock network changed
+            clock_cache_.invalidate_edge(edge);
+        }
+
+        void invalidate_edges_impl(const edge_range edges) override {
+            for (EdgeId edge : edges) {
+                clock_cache_.invalidate_edge(edge);
+            }
         }
 
         void clear_invalidated_edges_impl() override {
             //Do nothing, this walker only does full updates
         }
 
+        void set_incr_invalidation_policy_impl(const IncrInvalidationPolicy /*policy*/) override {
+            //Do nothing, this walker only does full updates
+        }
+
+        void set_clock_network_caching_impl(bool enable) override {
+            clock_cache_.set_enabled(enable);
+        }
+
         node_range modified_nodes_impl() const override {
             return tatum::util::make_range(nodes_modified_.cbegin(), nodes_modified_.cend());
         }
@@ -96,8 +115,10 @@ class ParallelLevelizedWalker : public TimingGraphWalker {
         }
 
         void do_arrival_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            bool skip_clock_network = clock_cache_.valid(visitor);
+
             for(LevelId level_id : tg.levels()) {
-                auto level_nodes = tg.level_nodes(level_id);
+                auto level_nodes = skip_clock_network ? clock_cache_.level_nodes(level_id) : tg.level_nodes(level_id);
 #if defined(TATUM_USE_TBB)
                 tbb::parallel_for_each(level_nodes.begin(), level_nodes.end(), [&](auto node) {
                     visitor.do_arrival_traverse_node(tg, tc, dc, node);
@@ -108,11 +129,18 @@ class ParallelLevelizedWalker : public TimingGraphWalker {
                 }
 #endif
             }
+
+            if (!skip_clock_network) {
+                //The clock network tags are now up-to-date
+                clock_cache_.mark_valid(tg, tc, visitor);
+            }
         }
 
         void do_required_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            bool skip_clock_network = clock_cache_.valid(visitor);
+
             for(LevelId level_id : tg.reversed_levels()) {
-                auto level_nodes = tg.level_nodes(level_id);
+                auto level_nodes = skip_clock_network ? clock_cache_.level_nodes(level_id) : tg.level_nodes(level_id);
 #if defined(TATUM_USE_TBB)
                 tbb::parallel_for_each(level_nodes.begin(), level_nodes.end(), [&](auto node) {
                     visitor.do_required_traverse_node(tg, tc, dc, node);
@@ -126,7 +154,7 @@ class ParallelLevelizedWalker : public TimingGraphWalker {
         }
 
         void do_update_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) override {
-            auto nodes = tg.nodes();
+            auto nodes = clock_cache_.valid(visitor) ? clock_cache_.nodes() : tg.nodes();
 #if defined(TATUM_USE_TBB)
             tbb::parallel_for_each(nodes.begin(), nodes.end(), [&](auto node) {
                 visitor.do_slack_traverse_node(tg, dc, node);
@@ -138,8 +166,22 @@ class ParallelLevelizedWalker : public TimingGraphWalker {
 #endif
         }
 
+        void do_update_endpoint_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            const auto& po = tg.logical_outputs();
+#if defined(TATUM_USE_TBB)
+            tbb::parallel_for_each(po.begin(), po.end(), [&](auto node) {
+                visitor.do_slack_traverse_node(tg, dc, node);
+            });
+#else //Serial
+            for(auto iter = po.begin(); iter != po.end(); ++iter) {
+                visitor.do_slack_traverse_node(tg, dc, *iter);
+            }
+#endif
+        }
+
         void do_reset_impl(const TimingGraph& tg, GraphVisitor& visitor) override {
-            auto nodes = tg.nodes();
+            //The cached clock network tags are left intact
+            auto nodes = clock_cache_.valid(visitor) ? clock_cache_.nodes() : tg.nodes();
 #if defined(TATUM_USE_TBB)
             tbb::parallel_for_each(nodes.begin(), nodes.end(), [&](auto node) {
                 visitor.do_reset_node(node);
@@ -180,6 +222,7 @@ class ParallelLevelizedWalker : public TimingGraphWalker {
         size_t num_unconstrained_startpoints_ = 0;
         size_t num_unconstrained_endpoints_ = 0;
         std::vector<NodeId> nodes_modified_;
+        ClockNetworkCache clock_cache_;
 };
 
 } //namepsace
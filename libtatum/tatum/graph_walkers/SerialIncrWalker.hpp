@@ -1,37 +1,26 @@
 #pragma once
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
 
 #ifdef TATUM_USE_TBB
 #include <tbb/concurrent_vector.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 #endif
 
 #include "tatum/graph_walkers/TimingGraphWalker.hpp"
+#include "tatum/graph_walkers/ParallelLevelizedWalker.hpp"
 #include "tatum/TimingGraph.hpp"
 #include "tatum/delay_calc/DelayCalculator.hpp"
 #include "tatum/graph_visitors/GraphVisitor.hpp"
+#include "tatum/util/tatum_generation_set.hpp"
+#include "tatum/base/IncrInvalidationPolicy.hpp"
 
 namespace tatum {
 
-/**
- * Controls how timing tags are invalidated during the incremental traversal.
- *
- * If TATUM_INCR_BLOCK_INVALIDATION is defined: 
- *      All of a nodes tags associated with an invalidated edge are invalidated.
- *      This is a robust but pessimisitc approach (it invalidates more tags than
- *      strictly required). As a result all nodes processed will report having been
- *      modified, meaning their decendents/predecessors will also be invalidated
- *      even if in reality the recalculated tags are identical to the previous ones
- *      (i.e. nothing has really changed).
- *
- * Ohterwise, the analyzer performs edge invalidation:
- *      Only node tags which are dominanted by an invalidated edge are invalidated.
- *      This is a less pessimistic approach, and means when processed nodes which
- *      don't have any changed tags will report as being unmodified. This significantly
- *      prunes the amount of the timing graph which needs to be updated (as unmodified
- *      nodes don't need to invalidate their decendents/predecessors.
- */
-//#define TATUM_INCR_BLOCK_INVALIDATION
-
 /**
  * A serial graph walker which traverses the timing graph in a levelized
  * manner. Unlike SerialWalker it attempts to incrementally (rather than
@@ -52,26 +41,125 @@ namespace tatum {
  * as nodes are modified their decendents/predessors may need to be updated
  * as well.
  *
+ * When many edges have been invalidated (e.g. via invalidate_edges()) and TBB
+ * is available, the per-level queues are seeded in parallel: each thread
+ * buckets the endpoints of its share of the invalidated edges by level into
+ * thread-local buffers, which are then merged into the queues level-by-level
+ * (also in parallel, since each node belongs to exactly one level).
+ *
+ * The sets of invalidated edges, enqueued nodes and modified nodes are tracked
+ * with generation_sets, so clearing them between updates is O(1) and the
+ * book-keeping cost of each update is proportional to the number of edges/nodes
+ * actually touched (rather than the size of the timing graph).
+ *
+ * How timing tags are invalidated during the incremental traversal is controlled
+ * at run-time by the IncrInvalidationPolicy (see set_incr_invalidation_policy()):
+ *
+ * IncrInvalidationPolicy::BLOCK:
+ *      All of a nodes tags associated with an invalidated edge are invalidated.
+ *      This is a robust but pessimisitc approach (it invalidates more tags than
+ *      strictly required). As a result all nodes processed will report having been
+ *      modified, meaning their decendents/predecessors will also be invalidated
+ *      even if in reality the recalculated tags are identical to the previous ones
+ *      (i.e. nothing has really changed).
+ *
+ * IncrInvalidationPolicy::EDGE (default):
+ *      Only node tags which are dominanted by an invalidated edge are invalidated.
+ *      This is a less pessimistic approach, and means when processed nodes which
+ *      don't have any changed tags will report as being unmodified. This significantly
+ *      prunes the amount of the timing graph which needs to be updated (as unmodified
+ *      nodes don't need to invalidate their decendents/predecessors.
+ *
+ * IncrInvalidationPolicy::ADAPTIVE:
+ *      Uses whichever of BLOCK or EDGE invalidation is predicted to be cheaper,
+ *      based on the number of nodes each re-traversed (relative to the initially
+ *      invalidated nodes) and their per-node cost in previous updates. The
+ *      alternative policy is periodically re-tried so the predictions track
+ *      changes in the workload.
+ *
+ * If a large fraction of the timing graph needs to be re-evaluated an incremental
+ * update is slower than a full update. Therefore, after identifying the nodes 
+ * directly invalidated, the walker estimates the size of the 'dirty cone' which 
+ * will be re-traversed. If the estimated incremental update cost exceeds the cost
+ * of a full update, the walker instead performs a full (parallel if TBB is 
+ * available) levelized update. The estimate is based on a simple cost model 
+ * learned from previous updates: the average growth of the dirty cone relative 
+ * to the initially invalidated nodes, the average incremental cost per processed 
+ * node, and the average cost of a full update. Whether a full update was performed
+ * is reported via the 'incr_fallback_to_full' profiling data.
+ *
+ * The required time traversal (and slack update) may also be deferred: if the
+ * arrival traversal is followed only by do_update_endpoint_slack() the endpoint
+ * slacks are up-to-date, while the required traversal's queued nodes and the set of
+ * modified nodes are retained until the next required traversal. If further edges
+ * are invalidated in the mean time only the newly invalidated edges are re-seeded
+ * for the next arrival traversal (which is skipped entirely if there are none).
+ *
+ * The full update's walker caches the clock network's tags (see ClockNetworkCache),
+ * so full updates skip the clock network unless one of its edges was invalidated.
+ *
  * Note that this graph walker assumes that timing constraints aren't changed
  * and so do_arrival_pre_traversal_impl() / do_required_pre_traversal_impl()
  * should only be called once (on the first analysis)
  */
 class SerialIncrWalker : public TimingGraphWalker {
+    public:
+        SerialIncrWalker() {
+            //All delay changes are reported to this walker as invalidated edges,
+            //so the full update walker can safely cache the clock network
+            full_walker_.set_clock_network_caching(true);
+        }
+
     protected:
         void invalidate_edge_impl(const EdgeId edge) override {
-            if (is_invalidated(edge)) return;
+            full_walker_.invalidate_edge(edge);
 
+            if (is_invalidated(edge) && !required_pending_) return;
+
+            //Note that while the required traversal is pending an already invalidated
+            //edge is recorded again, since its delay may have changed after the last
+            //arrival traversal (and so must be re-seeded)
             invalidated_edges_.push_back(edge);
 
             mark_invalidated(edge);
         }
 
+        void invalidate_edges_impl(const edge_range edges) override {
+            if (edges.empty()) return;
+
+            full_walker_.invalidate_edges(edges);
+
+            //Size the membership set once up-front, rather than potentially
+            //re-sizing for each edge
+            EdgeId max_edge = *std::max_element(edges.begin(), edges.end());
+            edge_invalidated_.resize(size_t(max_edge) + 1);
+
+            for (EdgeId edge : edges) {
+                if (edge_invalidated_.insert(edge) || required_pending_) {
+                    invalidated_edges_.push_back(edge);
+                }
+            }
+        }
+
         void clear_invalidated_edges_impl() override {
             invalidated_edges_.clear();
             edge_invalidated_.clear();
+            num_invalidated_edges_seeded_ = 0;
+        }
+
+        void set_incr_invalidation_policy_impl(const IncrInvalidationPolicy policy) override {
+            invalidation_policy_ = policy;
+        }
+
+        void set_clock_network_caching_impl(bool /*enable*/) override {
+            //Do nothing, incremental updates only re-traverse the clock network
+            //if its edges are invalidated (and the full update walker always caches it)
         }
 
         node_range modified_nodes_impl() const override {
+            if (full_update_) {
+                return full_walker_.modified_nodes();
+            }
             return tatum::util::make_range(nodes_modified_.cbegin(), nodes_modified_.cend());
         }
 
@@ -105,8 +193,47 @@ class SerialIncrWalker : public TimingGraphWalker {
         }
 
         void do_arrival_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            if (required_pending_ && invalidated_edges_.size() == num_invalidated_edges_seeded_) {
+                //The arrival traversal was already performed (with the required traversal 
+                //deferred), and no edges have been invalidated since: nothing to do
+                return;
+            }
+
+            auto prepare_start = std::chrono::high_resolution_clock::now();
+
             prepare_incr_update(tg);
 
+            double prepare_sec = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::high_resolution_clock::now() - prepare_start).count();
+            set_profiling_data("incr_prepare_sec", prepare_sec);
+            set_profiling_data("num_invalidated_edges", invalidated_edges_.size());
+
+            if (!required_pending_) {
+                //Keep the current policy if the required traversal is pending, so it matches
+                //the arrival traversal which queued it
+                active_invalidation_policy_ = select_invalidation_policy();
+            }
+            set_profiling_data("incr_block_invalidation", active_invalidation_policy_ == IncrInvalidationPolicy::BLOCK);
+
+            //Note that if a pending required traversal was queued by a full update it must also
+            //be full (since all required times were reset)
+            bool fallback_to_full = should_fallback_to_full_update(tg);
+            full_update_ = fallback_to_full || (required_pending_ && full_update_);
+            set_profiling_data("incr_fallback_to_full", full_update_);
+
+            required_pending_ = true;
+
+            if (full_update_) {
+                //Re-calculate everything from scratch
+                full_walker_.do_reset(tg, visitor);
+                full_walker_.do_arrival_pre_traversal(tg, tc, visitor);
+                full_walker_.do_arrival_traversal(tg, tc, dc, visitor);
+
+                set_profiling_data("num_arrival_nodes_processed", tg.nodes().size());
+                num_invalidated_edges_seeded_ = invalidated_edges_.size();
+                return;
+            }
+
+            size_t num_nodes_processed = 0;
             for(int level_idx = incr_arr_update_.min_level; level_idx <= incr_arr_update_.max_level; ++level_idx) {
                 LevelId level(level_idx);
 
@@ -116,6 +243,8 @@ class SerialIncrWalker : public TimingGraphWalker {
                 //timing graph is laid out in traversal order
                 sort(level_nodes);
 
+                num_nodes_processed += level_nodes.size();
+
                 for (NodeId node : level_nodes) {
 
                     invalidate_node_for_arrival_traversal(node, tg, visitor);
@@ -134,9 +263,26 @@ class SerialIncrWalker : public TimingGraphWalker {
                     }
                 }
             }
+
+            set_profiling_data("num_arrival_nodes_processed", num_nodes_processed);
+            num_arr_nodes_processed_ = num_nodes_processed;
+
+            //Note that the traversal may itself have invalidated edges (which need not be re-seeded)
+            num_invalidated_edges_seeded_ = invalidated_edges_.size();
         }
 
         void do_required_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            required_pending_ = false;
+
+            if (full_update_) {
+                full_walker_.do_required_pre_traversal(tg, tc, visitor);
+                full_walker_.do_required_traversal(tg, tc, dc, visitor);
+
+                set_profiling_data("num_required_nodes_processed", tg.nodes().size());
+                return;
+            }
+
+            size_t num_nodes_processed = 0;
 
             for(int level_idx = incr_req_update_.max_level; level_idx >= incr_req_update_.min_level; --level_idx) {
                 LevelId level(level_idx);
@@ -147,6 +293,8 @@ class SerialIncrWalker : public TimingGraphWalker {
                 //timing graph is laid out in traversal order
                 sort(level_nodes);
 
+                num_nodes_processed += level_nodes.size();
+
                 for (NodeId node : level_nodes) {
                     invalidate_node_for_required_traversal(node, tg, visitor);
                     bool node_updated = visitor.do_required_traverse_node(tg, tc, dc, node);
@@ -164,11 +312,50 @@ class SerialIncrWalker : public TimingGraphWalker {
                     }
                 }
             }
+
+            set_profiling_data("num_required_nodes_processed", num_nodes_processed);
+            num_req_nodes_processed_ = num_nodes_processed;
         }
 
         void do_update_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            auto start_time = std::chrono::high_resolution_clock::now();
+
+            if (full_update_) {
+                full_walker_.do_update_slack(tg, dc, visitor);
+
+                set_profiling_data("num_modified_nodes", tg.nodes().size());
+            } else {
+                incr_update_slack(tg, dc, visitor);
+            }
+
+            double slack_sec = std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::high_resolution_clock::now() - start_time).count();
+
+            //The slack update is the final step of an update, so we now know the
+            //update's full cost
+            update_cost_model(slack_sec);
+        }
+
+        void do_update_endpoint_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            if (full_update_) {
+                full_walker_.do_update_endpoint_slack(tg, dc, visitor);
+                return;
+            }
+
+            //Only endpoints modified by the arrival traversal can have changed slack
+            for(NodeId node : nodes_modified_) {
+                if (tg.node_type(node) != NodeType::SINK) continue;
+
+                visitor.do_reset_node_slack_tags(node);
+
+                visitor.do_slack_traverse_node(tg, dc, node);
+            }
+        }
+
+        void incr_update_slack(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) {
             sort(nodes_modified_);
 
+            set_profiling_data("num_modified_nodes", nodes_modified_.size());
+
             //std::cout << "Processing slack updates for " << nodes_modified_.size() << " nodes\n";
 
             for(NodeId node : nodes_modified_) {
@@ -185,6 +372,92 @@ class SerialIncrWalker : public TimingGraphWalker {
             }
         }
 
+        //Returns true if the estimated cost of an incremental update (based on the
+        //queued nodes, which must already have been prepared) exceeds that of a full update
+        bool should_fallback_to_full_update(const TimingGraph& tg) {
+            num_seed_nodes_ = incr_arr_update_.total_nodes_to_process() + incr_req_update_.total_nodes_to_process();
+
+            const t_incr_cost_model& model = cost_model(active_invalidation_policy_);
+
+            //Arrival and required traversals may each touch every node
+            double max_nodes = 2 * tg.nodes().size();
+            double est_nodes = std::min(max_nodes, model.cone_growth * num_seed_nodes_);
+            set_profiling_data("incr_estimated_dirty_nodes", est_nodes);
+
+            double threshold_nodes;
+            if (std::isnan(full_update_sec_) || std::isnan(model.sec_per_node)) {
+                //No cost model yet, fall back to a fixed fraction of the graph
+                threshold_nodes = DEFAULT_FULL_UPDATE_FRACTION * max_nodes;
+            } else {
+                //Number of processed nodes beyond which an incremental update is 
+                //predicted to be slower than a full update
+                threshold_nodes = full_update_sec_ / model.sec_per_node;
+            }
+            set_profiling_data("incr_fallback_threshold_nodes", threshold_nodes);
+
+            return num_seed_nodes_ > 0 && est_nodes > threshold_nodes;
+        }
+
+        //Updates the learned cost model based on the update which was just completed
+        void update_cost_model(double slack_sec) {
+            double update_sec = get_profiling_data("arrival_traversal_sec") 
+                                + get_profiling_data("required_traversal_sec")
+                                + slack_sec;
+
+            if (full_update_) {
+                full_update_sec_ = moving_average(full_update_sec_, update_sec);
+            } else {
+                t_incr_cost_model& model = cost_model(active_invalidation_policy_);
+
+                size_t num_nodes_processed = num_arr_nodes_processed_ + num_req_nodes_processed_;
+                if (num_nodes_processed > 0) {
+                    model.sec_per_node = moving_average(model.sec_per_node, update_sec / num_nodes_processed);
+                }
+                if (num_seed_nodes_ > 0) {
+                    model.cone_growth = moving_average(model.cone_growth, double(num_nodes_processed) / num_seed_nodes_);
+                    ++model.num_updates;
+                }
+            }
+        }
+
+        //Returns the invalidation policy (BLOCK or EDGE) to use for the next update
+        IncrInvalidationPolicy select_invalidation_policy() {
+#ifdef TATUM_NO_TAG_ORIGINS
+            //Edge invalidation requires tags to track their origin nodes
+            return IncrInvalidationPolicy::BLOCK;
+#else
+            if (invalidation_policy_ != IncrInvalidationPolicy::ADAPTIVE) {
+                return invalidation_policy_;
+            }
+
+            //Try each policy at least once
+            if (edge_cost_model_.num_updates == 0) return IncrInvalidationPolicy::EDGE;
+            if (block_cost_model_.num_updates == 0) return IncrInvalidationPolicy::BLOCK;
+
+            //Pick the policy with the lowest predicted cost per initially invalidated node
+            double edge_cost = edge_cost_model_.cone_growth * edge_cost_model_.sec_per_node;
+            double block_cost = block_cost_model_.cone_growth * block_cost_model_.sec_per_node;
+
+            IncrInvalidationPolicy best = IncrInvalidationPolicy::EDGE;
+            IncrInvalidationPolicy other = IncrInvalidationPolicy::BLOCK;
+            if (block_cost < edge_cost) {
+                std::swap(best, other);
+            }
+
+            //Periodically re-try the other policy, in case the workload has changed
+            ++num_adaptive_selections_;
+            if (num_adaptive_selections_ % ADAPTIVE_RETRY_PERIOD == 0) {
+                return other;
+            }
+            return best;
+#endif
+        }
+
+        static double moving_average(double avg, double new_val) {
+            if (std::isnan(avg)) return new_val;
+            return (1. - COST_MODEL_WEIGHT) * avg + COST_MODEL_WEIGHT * new_val;
+        }
+
         void do_reset_impl(const TimingGraph& tg, GraphVisitor& visitor) override {
             for(NodeId node_id : tg.nodes()) {
                 visitor.do_reset_node(node_id);
@@ -201,10 +474,7 @@ class SerialIncrWalker : public TimingGraphWalker {
     private:
 
         bool is_invalidated(EdgeId edge) const {
-            if (edge_invalidated_.size() > size_t(edge)) {
-                return edge_invalidated_[edge];
-            }
-            return false; //Not yet marked, so not invalid
+            return edge_invalidated_.contains(edge);
         }
 
         bool not_invalidated(EdgeId edge) const {
@@ -212,24 +482,15 @@ class SerialIncrWalker : public TimingGraphWalker {
         }
 
         void mark_invalidated(EdgeId edge) {
-            if (edge_invalidated_.size() <= size_t(edge)) {
-                edge_invalidated_.resize(size_t(edge)+1, false);
-            }
-            edge_invalidated_[edge] = true;
+            edge_invalidated_.insert(edge);
         }
 
         bool is_modified(NodeId node) const {
-            if (node_is_modified_.size() > size_t(node)) {
-                return node_is_modified_[node];
-            }
-            return false; //Not yet marked, so not queued
+            return node_is_modified_.contains(node);
         }
 
         void mark_modified(NodeId node) {
-            if (node_is_modified_.size() <= size_t(node)) {
-                node_is_modified_.resize(size_t(node)+1, false);
-            }
-            node_is_modified_[node] = true;
+            node_is_modified_.insert(node);
         }
 
         void clear_modified() {
@@ -242,19 +503,37 @@ class SerialIncrWalker : public TimingGraphWalker {
         }
 
         void prepare_incr_update(const TimingGraph& tg) {
-            //Reset incremental traversal tracking data
-            clear_modified();
+            //Reset incremental traversal tracking data.
+            //
+            //If the required traversal is pending (deferred), the nodes it has queued, and
+            //the nodes modified by the previous arrival traversal, are retained
             resize_incr_update_levels(tg);
             incr_arr_update_.clear(tg);
-            incr_req_update_.clear(tg);
+            if (!required_pending_) {
+                clear_modified();
+                incr_req_update_.clear(tg);
+            }
 
-            incr_arr_update_.min_level = size_t(*(tg.levels().end() - 1));
-            incr_arr_update_.max_level = size_t(*tg.levels().begin());
-            incr_req_update_.min_level = size_t(*(tg.levels().end() - 1));
-            incr_req_update_.max_level = size_t(*tg.levels().begin());
+            //Size the membership sets to cover the whole graph (a no-op after the
+            //first update), so they are never re-sized during the traversals
+            node_is_modified_.resize(tg.nodes().size());
+            incr_arr_update_.reserve_nodes(tg);
+            incr_req_update_.reserve_nodes(tg);
+            edge_invalidated_.resize(tg.edges().size());
+
+            //Process the externally invalidated edges to prepare for the incremental traversal.
+            //Only edges invalidated since the last arrival traversal need to be processed
+            //if the required traversal is pending
+            size_t first_edge_idx = required_pending_ ? num_invalidated_edges_seeded_ : 0;
+#ifdef TATUM_USE_TBB
+            if (invalidated_edges_.size() - first_edge_idx >= MIN_EDGES_FOR_PARALLEL_SEEDING) {
+                seed_incr_update_parallel(tg, first_edge_idx);
+                return;
+            }
+#endif
+            for (size_t i = first_edge_idx; i < invalidated_edges_.size(); ++i) {
+                EdgeId edge = invalidated_edges_[i];
 
-            //Process the externally invalidated edges to prepare for the incremental traversal
-            for (EdgeId edge : invalidated_edges_) {
                 NodeId snk_node = tg.edge_sink_node(edge);
                 enqueue_arr_node(tg, snk_node, edge);
 
@@ -263,15 +542,83 @@ class SerialIncrWalker : public TimingGraphWalker {
             }
         }
 
+#ifdef TATUM_USE_TBB
+        //Seeds the incremental arrival/required update queues from the invalidated edges in parallel.
+        //
+        //All invalidated edges are already marked in edge_invalidated_, so (unlike the serial
+        //seeding in prepare_incr_update()) we only need to enqueue their sink/source nodes.
+        void seed_incr_update_parallel(const TimingGraph& tg, size_t first_edge_idx) {
+            size_t num_levels = tg.levels().size();
+
+            //Per-thread buffers of the nodes to enqueue, bucketed by level
+            tbb::enumerable_thread_specific<t_incr_seed_buffer> seed_buffers([num_levels]() {
+                return t_incr_seed_buffer(num_levels);
+            });
+
+            tbb::parallel_for(tbb::blocked_range<size_t>(first_edge_idx, invalidated_edges_.size()), [&](const tbb::blocked_range<size_t>& edge_indices) {
+                t_incr_seed_buffer& buf = seed_buffers.local();
+
+                for (size_t i = edge_indices.begin(); i != edge_indices.end(); ++i) {
+                    EdgeId edge = invalidated_edges_[i];
+
+                    NodeId snk_node = tg.edge_sink_node(edge);
+                    buf.arr.add_node(snk_node, size_t(tg.node_level(snk_node)));
+
+                    NodeId src_node = tg.edge_src_node(edge);
+                    buf.req.add_node(src_node, size_t(tg.node_level(src_node)));
+                }
+            });
+
+            //Determine the range of levels touched by any thread
+            int arr_min_level = incr_arr_update_.min_level;
+            int arr_max_level = incr_arr_update_.max_level;
+            int req_min_level = incr_req_update_.min_level;
+            int req_max_level = incr_req_update_.max_level;
+            for (const t_incr_seed_buffer& buf : seed_buffers) {
+                arr_min_level = std::min(arr_min_level, buf.arr.min_level);
+                arr_max_level = std::max(arr_max_level, buf.arr.max_level);
+                req_min_level = std::min(req_min_level, buf.req.min_level);
+                req_max_level = std::max(req_max_level, buf.req.max_level);
+            }
+
+            //Merge the per-thread buffers into the level queues. Each node is on exactly
+            //one level, so different levels can safely be merged concurrently
+            tbb::parallel_for(arr_min_level, arr_max_level + 1, [&](int level) {
+                for (const t_incr_seed_buffer& buf : seed_buffers) {
+                    incr_arr_update_.enqueue_level_nodes(level, buf.arr.nodes_by_level[level]);
+                }
+            });
+            tbb::parallel_for(req_min_level, req_max_level + 1, [&](int level) {
+                for (const t_incr_seed_buffer& buf : seed_buffers) {
+                    incr_req_update_.enqueue_level_nodes(level, buf.req.nodes_by_level[level]);
+                }
+            });
+
+            incr_arr_update_.min_level = arr_min_level;
+            incr_arr_update_.max_level = arr_max_level;
+            incr_req_update_.min_level = req_min_level;
+            incr_req_update_.max_level = req_max_level;
+        }
+#endif
+
+        //Records edge as invalidated by the incremental traversal itself
+        void add_invalidated_edge(EdgeId edge) {
+            if (is_invalidated(edge)) return;
+
+            invalidated_edges_.push_back(edge);
+
+            mark_invalidated(edge);
+        }
+
         //Enqueues a node for arrival time processing which was invalidated by invalidated_edge
         void enqueue_arr_node(const TimingGraph& tg, NodeId node, EdgeId invalidated_edge) {
-            invalidate_edge_impl(invalidated_edge);
+            add_invalidated_edge(invalidated_edge);
             incr_arr_update_.enqueue_node(tg, node);
         }
 
         //Enqueues a node for required time processing which was invalidated by invalidated_edge
         void enqueue_req_node(const TimingGraph& tg, NodeId node, EdgeId invalidated_edge) {
-            invalidate_edge_impl(invalidated_edge);
+            add_invalidated_edge(invalidated_edge);
             incr_req_update_.enqueue_node(tg, node);
         }
 
@@ -285,33 +632,37 @@ class SerialIncrWalker : public TimingGraphWalker {
         }
 
         void invalidate_node_for_arrival_traversal(const NodeId node, const TimingGraph& tg, GraphVisitor& visitor) {
+            if (active_invalidation_policy_ == IncrInvalidationPolicy::BLOCK) {
+                //Block invalidation
+                //
+                //Invalidates the entire node (all the nodes arrival tags)
+                //As a result, when processed the node will be re-computed from scratch
+                visitor.do_reset_node_arrival_tags(node);
+            }
 
-#ifdef TATUM_INCR_BLOCK_INVALIDATION
-            //Block invalidation
-            //
-            //Invalidates the entire node (all the nodes arrival tags)
-            //As a result, when processed the node will be re-computed from scratch
-            visitor.do_reset_node_arrival_tags(node);
-#else
-            //Edge invalidation
             for (EdgeId edge : tg.node_in_edges(node)) {
                 if (not_invalidated(edge)) continue;
-                //Data arrival tags track their associated origin node (i.e. dominant
-                //edge which determines the tag value). Rather than invalidate all
-                //tags to ensure the correctly updated tag when the node is re-traversed,
-                //we can get away with only invalidating the tag when the dominant edge
-                //is invalidated.
-                //
-                //This ensures that cases where non-dominate edges change delay value,
-                //but not in ways which effect the tag value, we detect that the tag
-                //is 'unchanged', which helps keep the number of updated nodes small.
-                NodeId src_node = tg.edge_src_node(edge);
-                visitor.do_reset_node_arrival_tags_from_origin(node, /*origin=*/src_node);
+
+                if (active_invalidation_policy_ == IncrInvalidationPolicy::EDGE) {
+                    //Edge invalidation
+                    //
+                    //Data arrival tags track their associated origin node (i.e. dominant
+                    //edge which determines the tag value). Rather than invalidate all
+                    //tags to ensure the correctly updated tag when the node is re-traversed,
+                    //we can get away with only invalidating the tag when the dominant edge
+                    //is invalidated.
+                    //
+                    //This ensures that cases where non-dominate edges change delay value,
+                    //but not in ways which effect the tag value, we detect that the tag
+                    //is 'unchanged', which helps keep the number of updated nodes small.
+                    NodeId src_node = tg.edge_src_node(edge);
+                    visitor.do_reset_node_arrival_tags_from_origin(node, /*origin=*/src_node);
+                }
 
                 //At SOURCE/SINK nodes clock launch/capture tags are converted into
                 //data arrival/required tags, so we also need to carefully reset those
                 //tags as well (since they don't track origin nodes this must be done
-                //seperately).
+                //seperately, regardless of the invalidation policy).
                 EdgeType edge_type = tg.edge_type(edge);
                 if (edge_type == EdgeType::PRIMITIVE_CLOCK_CAPTURE) {
                     //We mark required times on sinks based the clock capture time during
@@ -340,25 +691,24 @@ class SerialIncrWalker : public TimingGraphWalker {
                     visitor.do_reset_node_arrival_tags(node);
                 }
             }
-#endif
         }
 
         void invalidate_node_for_required_traversal(const NodeId node, const TimingGraph& tg, GraphVisitor& visitor) {
-#ifdef TATUM_INCR_BLOCK_INVALIDATION
-            //Block invalidation
-            //
-            //Invalidates the entire node (all the nodes arrival tags)
-            //As a result, when processed the node will be re-computed from scratch
-            visitor.do_reset_node_required_tags(node);
-#else
-            //Edge invalidation
-            for (EdgeId edge : tg.node_out_edges(node)) {
-                if (not_invalidated(edge)) continue;
-
-                NodeId snk_node = tg.edge_sink_node(edge);
-                visitor.do_reset_node_required_tags_from_origin(node, /*origin=*/snk_node);
+            if (active_invalidation_policy_ == IncrInvalidationPolicy::BLOCK) {
+                //Block invalidation
+                //
+                //Invalidates the entire node (all the nodes required tags)
+                //As a result, when processed the node will be re-computed from scratch
+                visitor.do_reset_node_required_tags(node);
+            } else {
+                //Edge invalidation
+                for (EdgeId edge : tg.node_out_edges(node)) {
+                    if (not_invalidated(edge)) continue;
+
+                    NodeId snk_node = tg.edge_sink_node(edge);
+                    visitor.do_reset_node_required_tags_from_origin(node, /*origin=*/snk_node);
+                }
             }
-#endif
         }
 
         void resize_incr_update_levels(const TimingGraph& tg) {
@@ -391,6 +741,27 @@ class SerialIncrWalker : public TimingGraphWalker {
                     max_level = std::max(max_level, level);
                 }
 
+                //Ensures the enqueued set covers every node, so it never needs to
+                //be re-sized while enqueuing
+                void reserve_nodes(const TimingGraph& tg) {
+                    node_is_enqueued.resize(tg.nodes().size());
+                }
+
+#ifdef TATUM_USE_TBB
+                //Enqueues the specified nodes (which must all be on level) without updating 
+                //min_level/max_level.
+                //
+                //May be called concurrently for different levels, provided reserve_nodes() 
+                //was called first.
+                void enqueue_level_nodes(int level, const std::vector<NodeId>& nodes) {
+                    for (NodeId node : nodes) {
+                        if (node_is_enqueued.insert(node)) {
+                            nodes_to_process[level].push_back(node);
+                        }
+                    }
+                }
+#endif
+
                 size_t total_nodes_to_process() const {
                     size_t cnt = 0;
                     for (int level = min_level; level <= max_level; ++level) {
@@ -404,10 +775,7 @@ class SerialIncrWalker : public TimingGraphWalker {
                 }
 
                 bool is_enqueued(NodeId node) const {
-                    if (node_is_enqueued.size() > size_t(node)) {
-                        return node_is_enqueued[node];
-                    }
-                    return false; //Not yet marked, so not queued
+                    return node_is_enqueued.contains(node);
                 }
 
                 void clear(const TimingGraph& tg) {
@@ -421,38 +789,122 @@ class SerialIncrWalker : public TimingGraphWalker {
                 }
             private:
                 void mark_enqueued(NodeId node) {
-                    if (node_is_enqueued.size() <= size_t(node)) {
-                        node_is_enqueued.resize(size_t(node)+1, false);
-                    }
-                    node_is_enqueued[node] = true;
+                    node_is_enqueued.insert(node);
+                }
+
+                //Set to record whether a node has already been enqueued.
+                //Note that enqueue_level_nodes() may mark different nodes concurrently
+                tatum::util::generation_set<NodeId> node_is_enqueued;
+
+        };
+
+#ifdef TATUM_USE_TBB
+        //Minimum number of invalidated edges before seeding the incremental update in parallel
+        //(below this the overhead of the thread-local buffers isn't worthwhile)
+        constexpr static size_t MIN_EDGES_FOR_PARALLEL_SEEDING = 4096;
+
+        /*
+         * Helper structs to record a single thread's contribution when seeding
+         * the incremental traversals in parallel
+         */
+        struct t_incr_level_buffer {
+            public:
+                t_incr_level_buffer(size_t num_levels)
+                    : nodes_by_level(num_levels)
+                    , min_level(num_levels - 1)
+                    , max_level(0) {}
+
+                void add_node(NodeId node, size_t level) {
+                    nodes_by_level[level].push_back(node);
+                    min_level = std::min(min_level, int(level));
+                    max_level = std::max(max_level, int(level));
                 }
 
-                //Bitset to record whether a node has already been enqueued
-                tatum::util::linear_map<NodeId,bool> node_is_enqueued;
+                std::vector<std::vector<NodeId>> nodes_by_level;
+                int min_level;
+                int max_level;
+        };
+
+        struct t_incr_seed_buffer {
+            public:
+                t_incr_seed_buffer(size_t num_levels)
+                    : arr(num_levels)
+                    , req(num_levels) {}
 
+                t_incr_level_buffer arr;
+                t_incr_level_buffer req;
         };
+#endif
 
         //State info about the incremental arr/req updates
         t_incr_traversal_update incr_arr_update_;
         t_incr_traversal_update incr_req_update_;
 
-        /** Set of invalidated edges, and bitset for membership.
+        /** Set of invalidated edges, and set for membership.
          * Use thread safe alternatives when TBB is on, since invalidate_edge_impl
          * may be called concurrently */
 #ifdef TATUM_USE_TBB
         tbb::concurrent_vector<EdgeId> invalidated_edges_;
-        tatum::util::linear_map<EdgeId, size_t> edge_invalidated_;
 #else
         std::vector<EdgeId> invalidated_edges_;
-        tatum::util::linear_map<EdgeId, bool> edge_invalidated_;
 #endif
+        tatum::util::generation_set<EdgeId> edge_invalidated_;
 
-        //Nodes which have been modified during timing update, and bitset for membership
+        //Nodes which have been modified during timing update, and set for membership
         std::vector<NodeId> nodes_modified_; 
-        tatum::util::linear_map<NodeId,bool> node_is_modified_;
+        tatum::util::generation_set<NodeId> node_is_modified_;
 
         size_t num_unconstrained_startpoints_ = 0;
         size_t num_unconstrained_endpoints_ = 0;
+
+        //Walker used to perform full updates, when they are predicted to be faster
+        //than an incremental update
+        ParallelLevelizedWalker full_walker_;
+
+        //Whether the current/last update was a full update
+        bool full_update_ = false;
+
+        //Whether the required traversal for the last arrival traversal has yet to be performed,
+        //and how many of invalidated_edges_ the last arrival traversal has processed
+        bool required_pending_ = false;
+        size_t num_invalidated_edges_seeded_ = 0;
+
+        //Book-keeping for the cost model
+        size_t num_seed_nodes_ = 0;
+        size_t num_arr_nodes_processed_ = 0;
+        size_t num_req_nodes_processed_ = 0;
+
+        //Learned cost model of incremental updates with a particular invalidation policy
+        struct t_incr_cost_model {
+            double cone_growth = 1.; //Ratio of processed nodes to initially invalidated nodes
+            double sec_per_node = std::numeric_limits<double>::quiet_NaN(); //Update cost per processed node (NaN until observed)
+            size_t num_updates = 0; //Number of updates observed
+        };
+        t_incr_cost_model block_cost_model_;
+        t_incr_cost_model edge_cost_model_;
+
+        t_incr_cost_model& cost_model(IncrInvalidationPolicy policy) {
+            TATUM_ASSERT(policy != IncrInvalidationPolicy::ADAPTIVE);
+            return (policy == IncrInvalidationPolicy::BLOCK) ? block_cost_model_ : edge_cost_model_;
+        }
+
+        double full_update_sec_ = std::numeric_limits<double>::quiet_NaN(); //Full update cost (NaN until observed)
+
+        //The requested invalidation policy, and the policy (BLOCK or EDGE) used by the current update
+        IncrInvalidationPolicy invalidation_policy_ = IncrInvalidationPolicy::EDGE;
+        IncrInvalidationPolicy active_invalidation_policy_ = IncrInvalidationPolicy::EDGE;
+        size_t num_adaptive_selections_ = 0;
+
+        //How often (in updates) the adaptive policy re-tries the currently slower invalidation policy
+        constexpr static size_t ADAPTIVE_RETRY_PERIOD = 16;
+
+        //Fraction of the maximum traversal work (i.e. all nodes in both the arrival and 
+        //required traversals) above which a full update is performed, until a cost model
+        //has been learned
+        constexpr static double DEFAULT_FULL_UPDATE_FRACTION = 0.5;
+
+        //Weight given to new observations when updating the cost model (exponential moving average)
+        constexpr static double COST_MODEL_WEIGHT = 0.25;
 };
 
 } //namepsace
@@ -1,5 +1,6 @@
 #pragma once
 #include "tatum/graph_walkers/TimingGraphWalker.hpp"
+#include "tatum/graph_walkers/ClockNetworkCache.hpp"
 #include "tatum/TimingGraph.hpp"
 #include "tatum/delay_calc/DelayCalculator.hpp"
 #include "tatum/graph_visitors/GraphVisitor.hpp"
@@ -9,17 +10,35 @@ namespace tatum {
 /**
  * A simple serial graph walker which traverses the timing graph in a levelized
  * manner.
+ *
+ * If clock network caching is enabled the clock network is only traversed when
+ * one of its edges has been invalidated (see ClockNetworkCache).
  */
 class SerialWalker : public TimingGraphWalker {
     protected:
-        void invalidate_edge_impl(const EdgeId /*edge*/) override {
-            //Do nothing, this walker only does full updates
+        void invalidate_edge_impl(const EdgeId edge) override {
+            //This walker only does full updates, but needs to know if the clock network changed
+            clock_cache_.invalidate_edge(edge);
+        }
+
+        void invalidate_edges_impl(const edge_range edges) override {
+            for (EdgeId edge : edges) {
+                clock_cache_.invalidate_edge(edge);
+            }
         }
 
         void clear_invalidated_edges_impl() override {
             //Do nothing, this walker only does full updates
         }
 
+        void set_incr_invalidation_policy_impl(const IncrInvalidationPolicy /*policy*/) override {
+            //Do nothing, this walker only does full updates
+        }
+
+        void set_clock_network_caching_impl(bool enable) override {
+            clock_cache_.set_enabled(enable);
+        }
+
         node_range modified_nodes_impl() const override {
             return tatum::util::make_range(nodes_modified_.cbegin(), nodes_modified_.cend());
         }
@@ -63,29 +82,49 @@ class SerialWalker : public TimingGraphWalker {
         }
 
         void do_arrival_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            bool skip_clock_network = clock_cache_.valid(visitor);
+
             for(LevelId level_id : tg.levels()) {
-                for(NodeId node_id : tg.level_nodes(level_id)) {
+                auto level_nodes = skip_clock_network ? clock_cache_.level_nodes(level_id) : tg.level_nodes(level_id);
+                for(NodeId node_id : level_nodes) {
                     visitor.do_arrival_traverse_node(tg, tc, dc, node_id);
                 }
             }
+
+            if (!skip_clock_network) {
+                //The clock network tags are now up-to-date
+                clock_cache_.mark_valid(tg, tc, visitor);
+            }
         }
 
         void do_required_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            bool skip_clock_network = clock_cache_.valid(visitor);
+
             for(LevelId level_id : tg.reversed_levels()) {
-                for(NodeId node_id : tg.level_nodes(level_id)) {
+                auto level_nodes = skip_clock_network ? clock_cache_.level_nodes(level_id) : tg.level_nodes(level_id);
+                for(NodeId node_id : level_nodes) {
                     visitor.do_required_traverse_node(tg, tc, dc, node_id);
                 }
             }
         }
 
         void do_update_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) override {
-            for(NodeId node : tg.nodes()) {
+            auto nodes = clock_cache_.valid(visitor) ? clock_cache_.nodes() : tg.nodes();
+            for(NodeId node : nodes) {
+                visitor.do_slack_traverse_node(tg, dc, node);
+            }
+        }
+
+        void do_update_endpoint_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            for(NodeId node : tg.logical_outputs()) {
                 visitor.do_slack_traverse_node(tg, dc, node);
             }
         }
 
         void do_reset_impl(const TimingGraph& tg, GraphVisitor& visitor) override {
-            for(NodeId node_id : tg.nodes()) {
+            //The cached clock network tags are left intact
+            auto nodes = clock_cache_.valid(visitor) ? clock_cache_.nodes() : tg.nodes();
+            for(NodeId node_id : nodes) {
                 visitor.do_reset_node(node_id);
             }
 #ifdef TATUM_CALCULATE_EDGE_SLACKS
@@ -101,6 +140,7 @@ class SerialWalker : public TimingGraphWalker {
         size_t num_unconstrained_startpoints_ = 0;
         size_t num_unconstrained_endpoints_ = 0;
         std::vector<NodeId> nodes_modified_;
+        ClockNetworkCache clock_cache_;
 };
 
 } //namepsace
@@ -1,9 +1,11 @@
 #pragma once
 #include "tatum/TimingGraphFwd.hpp"
-#include "tatum/TimingConstraintsFwd.hpp"
+#include "tatum/TimingConstraints.hpp"
 #include "tatum/delay_calc/DelayCalculator.hpp"
 #include "tatum/graph_visitors/GraphVisitor.hpp"
 #include "tatum/util/tatum_range.hpp"
+#include "tatum/base/IncrInvalidationPolicy.hpp"
+#include "tatum/util/tatum_assert.hpp"
 #include <chrono>
 #include <map>
 #include <vector>
@@ -25,6 +27,7 @@ namespace tatum {
 class TimingGraphWalker {
     public:
         typedef tatum::util::Range<std::vector<NodeId>::const_iterator> node_range;
+        typedef tatum::util::Range<std::vector<EdgeId>::const_iterator> edge_range;
 
     public:
         virtual ~TimingGraphWalker() = default;
@@ -34,10 +37,27 @@ class TimingGraphWalker {
             invalidate_edge_impl(edge);
         }
 
+        ///Invalidates the specified set of timing graph edges (for incremental updates)
+        void invalidate_edges(const edge_range edges) {
+            invalidate_edges_impl(edges);
+        }
+
         void clear_invalidated_edges() {
             clear_invalidated_edges_impl();
         }
 
+        ///Sets how timing tags are invalidated during incremental updates
+        ///(ignored by walkers which only perform full updates)
+        void set_incr_invalidation_policy(const IncrInvalidationPolicy policy) {
+            set_incr_invalidation_policy_impl(policy);
+        }
+
+        ///Sets whether the clock network's tags are cached across full updates
+        ///(ignored by incremental walkers)
+        void set_clock_network_caching(bool enable) {
+            set_clock_network_caching_impl(enable);
+        }
+
         node_range modified_nodes() const {
             return modified_nodes_impl();
         }
@@ -71,6 +91,10 @@ class TimingGraphWalker {
         ///\param dc The edge delay calculator
         ///\param visitor The visitor to apply during the traversal
         void do_arrival_traversal(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) {
+            //Every update performs an arrival traversal, which relies on the look-up tables
+            //(e.g. domain pair ids) built when the constraints are frozen
+            TATUM_ASSERT_MSG(tc.frozen(), "Timing constraints must be frozen (see TimingConstraints::freeze()) before analysis");
+
             auto start_time = Clock::now();
 
             do_arrival_traversal_impl(tg, tc, dc, visitor);
@@ -90,6 +114,19 @@ class TimingGraphWalker {
             profiling_data_["required_traversal_sec"] = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
         }
 
+        ///Updates the slacks of the timing endpoints (i.e. logical outputs) only,
+        ///which requires only the arrival traversal to have been performed
+        ///\param tg The timing graph
+        ///\param dc The edge delay calculator
+        ///\param visitor The visitor to apply during the traversal
+        void do_update_endpoint_slack(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) {
+            auto start_time = Clock::now();
+
+            do_update_endpoint_slack_impl(tg, dc, visitor);
+
+            profiling_data_["update_endpoint_slack_sec"] = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
+        }
+
         void do_reset(const TimingGraph& tg, GraphVisitor& visitor) {
             auto start_time = Clock::now();
 
@@ -129,9 +166,16 @@ class TimingGraphWalker {
         ///Sub-class defined edge invalidation
         virtual void invalidate_edge_impl(const EdgeId edge) = 0;
 
+        ///Sub-class defined bulk edge invalidation
+        virtual void invalidate_edges_impl(const edge_range edges) = 0;
+
         ///Sub-class defined clearing of edge invalidation
         virtual void clear_invalidated_edges_impl() = 0;
 
+        ///Sub-class defined incremental invalidation policy selection
+        virtual void set_incr_invalidation_policy_impl(const IncrInvalidationPolicy policy) = 0;
+        virtual void set_clock_network_caching_impl(bool enable) = 0;
+
         ///Sub-class defined clearing of edge invalidation
         virtual node_range modified_nodes_impl() const = 0;
 
@@ -168,6 +212,9 @@ class TimingGraphWalker {
         ///Sub-class defined slack calculation
         virtual void do_update_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) = 0;
 
+        ///Sub-class defined endpoint slack calculation
+        virtual void do_update_endpoint_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) = 0;
+
         virtual size_t num_unconstrained_startpoints_impl() const = 0;
         virtual size_t num_unconstrained_endpoints_impl() const = 0;
 
@@ -166,23 +166,27 @@ std::vector<SkewPath> collect_worst_skew_paths(const TimingGraph& timing_graph,
 
 } //namespace detail
 
-std::vector<TimingPath> TimingPathCollector::collect_worst_setup_timing_paths(const TimingGraph& timing_graph, const tatum::SetupTimingAnalyzer& setup_analyzer, size_t npaths) const {
-    detail::SetupTagRetriever tag_retriever(setup_analyzer);
+std::vector<TimingPath> TimingPathCollector::collect_worst_setup_timing_paths(const TimingGraph& timing_graph, const tatum::SetupTimingAnalyzer& setup_analyzer, size_t npaths, size_t corner) const {
+    detail::SetupTagRetriever setup_tag_retriever(setup_analyzer);
+    detail::CornerTagRetriever tag_retriever(timing_graph, setup_tag_retriever, corner);
     return collect_worst_timing_paths(timing_graph, tag_retriever, npaths);
 }
 
-std::vector<TimingPath> TimingPathCollector::collect_worst_hold_timing_paths(const TimingGraph& timing_graph, const tatum::HoldTimingAnalyzer& hold_analyzer, size_t npaths) const {
-    detail::HoldTagRetriever tag_retriever(hold_analyzer);
+std::vector<TimingPath> TimingPathCollector::collect_worst_hold_timing_paths(const TimingGraph& timing_graph, const tatum::HoldTimingAnalyzer& hold_analyzer, size_t npaths, size_t corner) const {
+    detail::HoldTagRetriever hold_tag_retriever(hold_analyzer);
+    detail::CornerTagRetriever tag_retriever(timing_graph, hold_tag_retriever, corner);
     return collect_worst_timing_paths(timing_graph, tag_retriever, npaths);
 }
 
-std::vector<SkewPath> TimingPathCollector::collect_worst_setup_skew_paths(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const tatum::SetupTimingAnalyzer& setup_analyzer, size_t npaths) const {
-    detail::SetupTagRetriever tag_retriever(setup_analyzer);
+std::vector<SkewPath> TimingPathCollector::collect_worst_setup_skew_paths(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const tatum::SetupTimingAnalyzer& setup_analyzer, size_t npaths, size_t corner) const {
+    detail::SetupTagRetriever setup_tag_retriever(setup_analyzer);
+    detail::CornerTagRetriever tag_retriever(timing_graph, setup_tag_retriever, corner);
     return collect_worst_skew_paths(timing_graph, timing_constraints, tag_retriever, TimingType::SETUP, npaths);
 }
 
-std::vector<SkewPath> TimingPathCollector::collect_worst_hold_skew_paths(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const tatum::HoldTimingAnalyzer& hold_analyzer, size_t npaths) const {
-    detail::HoldTagRetriever tag_retriever(hold_analyzer);
+std::vector<SkewPath> TimingPathCollector::collect_worst_hold_skew_paths(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, const tatum::HoldTimingAnalyzer& hold_analyzer, size_t npaths, size_t corner) const {
+    detail::HoldTagRetriever hold_tag_retriever(hold_analyzer);
+    detail::CornerTagRetriever tag_retriever(timing_graph, hold_tag_retriever, corner);
     return collect_worst_skew_paths(timing_graph, timing_constraints, tag_retriever, TimingType::HOLD, npaths);
 }
 
@@ -1,6 +1,12 @@
 #ifndef TATUM_TIMING_REPORT_TAG_RETRIEVER_HPP
 #define TATUM_TIMING_REPORT_TAG_RETRIEVER_HPP
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include "tatum/timing_analyzers.hpp"
+#include "tatum/TimingGraph.hpp"
+#include "tatum/util/tatum_linear_map.hpp"
 #include "tatum/report/TimingPathFwd.hpp"
 #include "tatum/base/TimingType.hpp"
 
@@ -65,6 +71,95 @@ namespace tatum { namespace detail {
             const HoldTimingAnalyzer& analyzer_;
     };
 
+    //Retrieves the tags of a single timing corner (see Time)
+    //
+    //With multiple timing corners each tag's time (in every corner) and origin are set to 
+    //those of the specified corner, so that reporting code (which uses Time::value() and 
+    //TimingTag::origin_node()) reports the specified corner. Each node's tags are copied 
+    //the first time they are retrieved, so this should not outlive any change to the 
+    //underlying tags.
+    //
+    //With a single corner the tags are retrieved directly from base_retriever.
+    class CornerTagRetriever : public TagRetriever {
+        public:
+            CornerTagRetriever(const TimingGraph& timing_graph, const TagRetriever& base_retriever, size_t corner)
+                : base_retriever_(base_retriever)
+                , corner_(corner) {
+                TATUM_ASSERT(corner_ < Time::num_corners());
+                if (Time::num_corners() == 1) return;
+
+                node_tags_ = tatum::util::linear_map<NodeId,std::unique_ptr<CornerTags>>(timing_graph.nodes().size());
+            }
+
+            TimingTags::tag_range tags(NodeId node) const override {
+                if (Time::num_corners() == 1) return base_retriever_.tags(node);
+
+                return make_range(corner_tags(node).tags);
+            }
+
+            TimingTags::tag_range tags(NodeId node, TagType tag_type) const override {
+                if (Time::num_corners() == 1) return base_retriever_.tags(node, tag_type);
+
+                //Tags are grouped by type
+                const std::vector<TimingTag>& node_tags = corner_tags(node).tags;
+                auto begin = std::find_if(node_tags.begin(), node_tags.end(), 
+                                          [&](const TimingTag& tag) { return tag.type() == tag_type; });
+                auto end = std::find_if(begin, node_tags.end(), 
+                                        [&](const TimingTag& tag) { return tag.type() != tag_type; });
+
+                return tatum::util::make_range(TimingTags::const_iterator(node_tags.data() + (begin - node_tags.begin())),
+                                               TimingTags::const_iterator(node_tags.data() + (end - node_tags.begin())));
+            }
+
+            TimingTags::tag_range slacks(NodeId node) const override {
+                if (Time::num_corners() == 1) return base_retriever_.slacks(node);
+
+                return make_range(corner_tags(node).slacks);
+            }
+
+            TimingType type() const override {
+                return base_retriever_.type();
+            }
+
+        private:
+            struct CornerTags {
+                std::vector<TimingTag> tags;
+                std::vector<TimingTag> slacks;
+            };
+
+            const CornerTags& corner_tags(NodeId node) const {
+                std::unique_ptr<CornerTags>& node_tags = node_tags_[node];
+                if (!node_tags) {
+                    node_tags = std::make_unique<CornerTags>();
+                    for (const TimingTag& tag : base_retriever_.tags(node)) {
+                        node_tags->tags.push_back(project(tag));
+                    }
+                    for (const TimingTag& tag : base_retriever_.slacks(node)) {
+                        node_tags->slacks.push_back(project(tag));
+                    }
+                }
+                return *node_tags;
+            }
+
+            TimingTag project(const TimingTag& tag) const {
+                TimingTag projected = tag;
+                projected.set_time(Time(tag.time().value(corner_)));
+                projected.set_origin_node(tag.origin_node(corner_));
+                return projected;
+            }
+
+            static TimingTags::tag_range make_range(const std::vector<TimingTag>& tags) {
+                return tatum::util::make_range(TimingTags::const_iterator(tags.data()),
+                                               TimingTags::const_iterator(tags.data() + tags.size()));
+            }
+
+        private:
+            const TagRetriever& base_retriever_;
+            size_t corner_;
+
+            mutable tatum::util::linear_map<NodeId,std::unique_ptr<CornerTags>> node_tags_;
+    };
+
 }} //namespace
 
 #endif
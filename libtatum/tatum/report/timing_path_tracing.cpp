@@ -2,11 +2,13 @@
 #include "tatum/report/TimingPath.hpp"
 #include "tatum/TimingGraph.hpp"
 #include "tatum/tags/TimingTags.hpp"
+#include "tatum/error.hpp"
 
 namespace tatum { namespace detail {
 
 NodeId find_startpoint(const TimingSubPath& path);
 NodeId find_endpoint(const TimingSubPath& path);
+void check_tags_track_origins();
 
 TimingPath trace_path(const TimingGraph& timing_graph,
                       const detail::TagRetriever& tag_retriever, 
@@ -78,6 +80,8 @@ TimingSubPath trace_clock_launch_path(const TimingGraph& timing_graph,
                                       const DomainId launch_domain,
                                       const DomainId capture_domain,
                                       const NodeId data_launch_node) {
+    check_tags_track_origins();
+
     TATUM_ASSERT(timing_graph.node_type(data_launch_node) == NodeType::SOURCE);
 
     /*
@@ -124,6 +128,8 @@ TimingSubPath trace_data_arrival_path(const TimingGraph& timing_graph,
                                       const DomainId launch_domain,
                                       const DomainId capture_domain,
                                       const NodeId data_capture_node) {
+    check_tags_track_origins();
+
     TATUM_ASSERT(timing_graph.node_type(data_capture_node) == NodeType::SINK);
 
     /*
@@ -180,6 +186,8 @@ TimingSubPath trace_clock_capture_path(const TimingGraph& timing_graph,
                                        const DomainId launch_domain,
                                        const DomainId capture_domain,
                                        const NodeId data_capture_node) {
+    check_tags_track_origins();
+
     TATUM_ASSERT(timing_graph.node_type(data_capture_node) == NodeType::SINK);
     /*
      * Backtrace the clock capture path
@@ -290,4 +298,10 @@ NodeId find_endpoint(const TimingSubPath& path) {
     return (--path.elements().end())->node();
 }
 
+void check_tags_track_origins() {
+#ifdef TATUM_NO_TAG_ORIGINS
+    throw tatum::Error("Timing paths can not be traced since timing tags do not track origin nodes (TATUM_NO_TAG_ORIGINS is defined)");
+#endif
+}
+
 }} //namespace
@@ -1,9 +1,12 @@
 #pragma once
+#include <array>
 #include <iosfwd>
 #include <limits>
 
 #include "tatum/Time.hpp"
 #include "tatum/TimingGraphFwd.hpp"
+#include "tatum/TimingConstraintsFwd.hpp"
+#include "tatum/util/tatum_aligned_alloc.hpp"
 
 namespace tatum {
 
@@ -36,8 +39,33 @@ bool is_const_gen_tag(const TimingTag& tag);
  *
  * NOTE: Timing analyzers usually operate on the collection of tags at a particular node.
  *       This is modelled by the separate 'TimingTags' class.
+ *
+ * Since there are many tags, they are stored compactly: the tag type is packed into the
+ * upper bits of the launch clock domain (limiting the number of clock domains to
+ * MAX_CLOCK_DOMAINS).
+ *
+ * Data required and slack tags also record the dense id of their (launch, capture) domain pair
+ * (see TimingConstraints::domain_pair_id()), so they can be matched with a single comparison.
+ * Other tags (and tags created without frozen constraints) have an invalid pair id, and are matched
+ * by their domains (which may be unspecified wildcards). Together this gives a 16 byte tag.
+ *
+ * If TATUM_NO_TAG_ORIGINS is defined the origin node is not stored (reducing tags to 12 bytes),
+ * and origin_node() always returns an invalid id. This means timing paths can not be traced
+ * (e.g. for detailed timing reports), and incremental analysis can only invalidate all of
+ * a node's tags (rather than those associated with a particular edge).
+ *
+ * With multiple timing corners (TIME_VEC_WIDTH > 1) each corner's time is max'd/min'd
+ * independently, and so each corner also tracks its own origin node.
  */
 class TimingTag {
+    public: //Constants
+        ///The number of bits used to store the tag type
+        constexpr static size_t TYPE_BITS = 3;
+
+        ///The maximum number of clock domains which can be represented in a tag
+        ///(one encoding is reserved for an invalid domain)
+        constexpr static size_t MAX_CLOCK_DOMAINS = (size_t(1) << (8*sizeof(DomainId) - TYPE_BITS)) - 1;
+
     public: //Static
         //Returns a tag suitable for use at a constant generator, during 
         //setup analysis.
@@ -74,26 +102,42 @@ class TimingTag {
         ///\param launch_domain The clock domain the tag was launched from
         ///\param capture_domain The clock domain the tag was captured on
         ///\param node The origin node's id (e.g. source/sink that originally launched/required this tag)
-        TimingTag(const Time& time_val, DomainId launch_domain, DomainId capture_domain, NodeId node, TagType type);
+        ///\param domain_pair The id of the launch/capture domain pair (only for fully specified domains)
+        TimingTag(const Time& time_val, DomainId launch_domain, DomainId capture_domain, NodeId node, TagType type,
+                  DomainPairId domain_pair=DomainPairId::INVALID());
 
         ///\param arr_time_val The tagged arrival time
         ///\param req_time_val The tagged required time
         ///\param base_tag The tag from which to copy auxilary meta-data (e.g. domain, launch node)
         TimingTag(const Time& time_val, NodeId origin, const TimingTag& base_tag);
 
+        //Tags share Time's (possibly extended) alignment, which plain new does not respect
+        static void* operator new(size_t size) { return util::aligned_new<alignof(Time)>(size); }
+        static void* operator new[](size_t size) { return util::aligned_new<alignof(Time)>(size); }
+        static void operator delete(void* ptr) { util::aligned_delete<alignof(Time)>(ptr); }
+        static void operator delete[](void* ptr) { util::aligned_delete<alignof(Time)>(ptr); }
 
     public: //Accessors
         ///\returns This tag's arrival time
         const Time& time() const { return time_; }
 
         ///\returns This tag's launching clock domain
-        DomainId launch_clock_domain() const { return launch_clock_domain_; }
+        DomainId launch_clock_domain() const { return unpack_domain(launch_clock_domain_); }
         DomainId capture_clock_domain() const { return capture_clock_domain_; }
 
-        ///\returns This tag's launching node's id
-        NodeId origin_node() const { return origin_node_; }
+        ///\returns The id of this tag's launch/capture domain pair, or DomainPairId::INVALID() if it has none
+        DomainPairId domain_pair() const { return domain_pair_; }
 
-        TagType type() const { return type_; }
+        ///\returns This tag's launching node's id (in the specified corner)
+#ifdef TATUM_NO_TAG_ORIGINS
+        NodeId origin_node(size_t /*corner*/=0) const { return NodeId::INVALID(); }
+#elif TIME_VEC_WIDTH > 1
+        NodeId origin_node(size_t corner=0) const { return origin_nodes_[corner]; }
+#else
+        NodeId origin_node(size_t /*corner*/=0) const { return origin_node_; }
+#endif
+
+        TagType type() const { return static_cast<TagType>(type_); }
 
     public: //Utility
         friend bool operator==(const TimingTag& lhs, const TimingTag& rhs);
@@ -102,16 +146,25 @@ class TimingTag {
         ///\param new_time The new value set as the tag's time
         void set_time(const Time& new_time) { time_ = new_time; }
 
-        ///\param new_clock_domain The new value set as the tag's source clock domain
-        void set_launch_clock_domain(const DomainId new_clock_domain) { launch_clock_domain_ = new_clock_domain; }
+        ///\param new_clock_domain The new value set as the tag's source clock domain (invalidates the domain pair)
+        void set_launch_clock_domain(const DomainId new_clock_domain) { launch_clock_domain_ = pack_domain(new_clock_domain); domain_pair_ = DomainPairId::INVALID(); }
+
+        ///\param new_clock_domain The new value set as the tag's capture clock domain (invalidates the domain pair)
+        void set_capture_clock_domain(const DomainId new_clock_domain) { capture_clock_domain_ = new_clock_domain; domain_pair_ = DomainPairId::INVALID(); }
 
-        ///\param new_clock_domain The new value set as the tag's capture clock domain
-        void set_capture_clock_domain(const DomainId new_clock_domain) { capture_clock_domain_ = new_clock_domain; }
+        ///\param new_domain_pair The id of the tag's launch/capture domain pair
+        void set_domain_pair(const DomainPairId new_domain_pair) { domain_pair_ = new_domain_pair; }
 
-        ///\param new_launch_node The new value set as the tag's launching node
+        ///\param new_launch_node The new value set as the tag's launching node (in every corner)
+#ifdef TATUM_NO_TAG_ORIGINS
+        void set_origin_node(const NodeId /*new_origin_node*/) {}
+#elif TIME_VEC_WIDTH > 1
+        void set_origin_node(const NodeId new_origin_node) { origin_nodes_.fill(new_origin_node); }
+#else
         void set_origin_node(const NodeId new_origin_node) { origin_node_ = new_origin_node; }
+#endif
 
-        void set_type(const TagType new_type) { type_ = new_type; }
+        void set_type(const TagType new_type) { type_ = static_cast<unsigned short>(new_type); }
 
         /*
          * Modification operations
@@ -134,17 +187,39 @@ class TimingTag {
         ///\returns true if the tag is modified, false otherwise
         bool min(const Time& new_time, const NodeId origin, const TimingTag& base_tag);
 
+        ///Resets the time (to reset_time) and origin of every corner whose origin is the specified node
+        ///\returns true if any corner was reset
+        bool reset_from_origin(const NodeId origin, const Time& reset_time);
+
     private:
         bool update(const Time& new_time, const NodeId origin, const TimingTag& base_tag);
+        void update_domains(const TimingTag& base_tag);
+
+#if TIME_VEC_WIDTH > 1
+        template<class Better>
+        bool update_corners(const Time& new_time, const NodeId origin, const TimingTag& base_tag, Better better);
+#endif
+
+        //Domains are packed offset by one, so that the (all ones) invalid
+        //domain id wraps-around to zero. This keeps unpacking branch-free.
+        static unsigned short pack_domain(const DomainId domain);
+        static DomainId unpack_domain(const unsigned short packed_domain);
 
         /*
          * Data
          */
         Time time_; //Required time
+#ifndef TATUM_NO_TAG_ORIGINS
+# if TIME_VEC_WIDTH > 1
+        std::array<NodeId,TIME_VEC_WIDTH> origin_nodes_; //Per-corner node which launched this arr/req time
+# else
         NodeId origin_node_; //Node which launched this arr/req time
-        DomainId launch_clock_domain_; //Clock domain for arr/req times
+# endif
+#endif
+        unsigned short launch_clock_domain_ : 8*sizeof(DomainId) - TYPE_BITS; //Packed clock domain for arr/req times
+        unsigned short type_ : TYPE_BITS; //The TagType
         DomainId capture_clock_domain_; //Clock domain for arr/req times
-        TagType type_;
+        DomainPairId domain_pair_; //Launch/capture domain pair (required/slack tags only)
 };
 
 
@@ -1,3 +1,5 @@
+#include <functional>
+
 #include "tatum/util/tatum_assert.hpp"
 
 namespace tatum {
@@ -7,35 +9,59 @@ namespace tatum {
  */
 
 inline TimingTag::TimingTag()
-    : time_(NAN)
-    , origin_node_(NodeId::INVALID())
-    , launch_clock_domain_(DomainId::INVALID())
-    , capture_clock_domain_(DomainId::INVALID())
-    , type_(TagType::UNKOWN)
+    : TimingTag(Time(NAN), DomainId::INVALID(), DomainId::INVALID(), NodeId::INVALID(), TagType::UNKOWN)
     {}
 
 inline TimingTag::TimingTag(const Time& time_val, 
                             const DomainId launch_domain, 
                             const DomainId capture_domain, 
                             const NodeId node, 
-                            const TagType new_type)
+                            const TagType new_type,
+                            const DomainPairId domain_pair)
     : time_(time_val)
+#if !defined(TATUM_NO_TAG_ORIGINS) && TIME_VEC_WIDTH == 1
     , origin_node_(node)
-    , launch_clock_domain_(launch_domain)
+#endif
+    , launch_clock_domain_(pack_domain(launch_domain))
+    , type_(static_cast<unsigned short>(new_type))
     , capture_clock_domain_(capture_domain)
-    , type_(new_type)
-    {}
+    , domain_pair_(domain_pair) {
+    set_origin_node(node);
+}
 
 inline TimingTag::TimingTag(const Time& time_val, NodeId origin, const TimingTag& base_tag)
     : time_(time_val)
+#if !defined(TATUM_NO_TAG_ORIGINS) && TIME_VEC_WIDTH == 1
     , origin_node_(origin)
-    , launch_clock_domain_(base_tag.launch_clock_domain())
-    , capture_clock_domain_(base_tag.capture_clock_domain())
-    , type_(base_tag.type())
-    {}
+#endif
+    , launch_clock_domain_(base_tag.launch_clock_domain_)
+    , type_(base_tag.type_)
+    , capture_clock_domain_(base_tag.capture_clock_domain_)
+    , domain_pair_(base_tag.domain_pair_) {
+    set_origin_node(origin);
+}
+
+inline unsigned short TimingTag::pack_domain(const DomainId domain) {
+    TATUM_ASSERT_SAFE(!domain || size_t(domain) < MAX_CLOCK_DOMAINS);
+    return static_cast<unsigned short>(size_t(domain) + 1) & MAX_CLOCK_DOMAINS;
+}
+
+inline DomainId TimingTag::unpack_domain(const unsigned short packed_domain) {
+    return DomainId(static_cast<unsigned short>(packed_domain - 1));
+}
 
 
 inline bool TimingTag::update(const Time& new_time, const NodeId origin, const TimingTag& base_tag) {
+    update_domains(base_tag);
+
+    //Update the tag
+    set_time(new_time);
+    set_origin_node(origin);
+
+    return true; //Modified
+}
+
+inline void TimingTag::update_domains(const TimingTag& base_tag) {
     TATUM_ASSERT(type() == base_tag.type()); //Type must be the same
 
     //Note that we check for a constant tag first, since we might 
@@ -48,19 +74,45 @@ inline bool TimingTag::update(const Time& new_time, const NodeId origin, const T
         //continue to propagate through the timing graph
         set_launch_clock_domain(base_tag.launch_clock_domain());
         set_capture_clock_domain(base_tag.capture_clock_domain());
+        set_domain_pair(base_tag.domain_pair());
     }
 
     TATUM_ASSERT((   launch_clock_domain() == base_tag.launch_clock_domain())
                   && capture_clock_domain() == base_tag.capture_clock_domain()); //Same domains
+}
 
-    //Update the tag
-    set_time(new_time);
-    set_origin_node(origin);
+#if TIME_VEC_WIDTH > 1
+template<class Better>
+inline bool TimingTag::update_corners(const Time& new_time, const NodeId origin, const TimingTag& base_tag, Better better) {
+    //Each corner is updated independently (along with its origin)
+    Time updated_time = time();
+    bool modified = false;
+    for (size_t corner = 0; corner < Time::num_corners(); ++corner) {
+        float curr_value = time().value(corner);
+        float new_value = new_time.value(corner);
+        if (std::isnan(curr_value) || better(new_value, curr_value)) {
+            updated_time.set_value(corner, new_value);
+#ifndef TATUM_NO_TAG_ORIGINS
+            origin_nodes_[corner] = origin;
+#endif
+            modified = true;
+        }
+    }
+    static_cast<void>(origin); //Unused if origins are not tracked
 
-    return true; //Modified
+    if (modified) {
+        update_domains(base_tag);
+        set_time(updated_time);
+    }
+
+    return modified;
 }
+#endif
 
 inline bool TimingTag::max(const Time& new_time, const NodeId origin, const TimingTag& base_tag) {
+#if TIME_VEC_WIDTH > 1
+    return update_corners(new_time, origin, base_tag, std::greater<float>());
+#else
     bool modified = false;
 
     //Need to min with existing value
@@ -72,9 +124,13 @@ inline bool TimingTag::max(const Time& new_time, const NodeId origin, const Timi
     }
 
     return modified;
+#endif
 }
 
 inline bool TimingTag::min(const Time& new_time, const NodeId origin, const TimingTag& base_tag) {
+#if TIME_VEC_WIDTH > 1
+    return update_corners(new_time, origin, base_tag, std::less<float>());
+#else
     bool modified = false;
 
     //Need to min with existing value
@@ -85,11 +141,46 @@ inline bool TimingTag::min(const Time& new_time, const NodeId origin, const Timi
     }
 
     return modified;
+#endif
+}
+
+inline bool TimingTag::reset_from_origin(const NodeId origin, const Time& reset_time) {
+#if defined(TATUM_NO_TAG_ORIGINS)
+    static_cast<void>(origin);
+    static_cast<void>(reset_time);
+    return false;
+#elif TIME_VEC_WIDTH > 1
+    bool reset = false;
+    for (size_t corner = 0; corner < Time::num_corners(); ++corner) {
+        if (origin_nodes_[corner] == origin) {
+            origin_nodes_[corner] = NodeId::INVALID();
+            time_.set_value(corner, reset_time.value(corner));
+            reset = true;
+        }
+    }
+    return reset;
+#else
+    if (origin_node_ == origin) {
+        set_origin_node(NodeId::INVALID());
+        set_time(reset_time);
+        return true;
+    }
+    return false;
+#endif
 }
 
 inline bool operator==(const TimingTag& lhs, const TimingTag& rhs) {
-    return std::tie(lhs.time_, lhs.origin_node_, lhs.launch_clock_domain_, lhs.capture_clock_domain_, lhs.type_) 
-           == std::tie(rhs.time_, rhs.origin_node_, rhs.launch_clock_domain_, rhs.capture_clock_domain_, rhs.type_);
+    //Note that bit-fields can't be std::tie()'d
+    return    lhs.time_ == rhs.time_
+#if !defined(TATUM_NO_TAG_ORIGINS) && TIME_VEC_WIDTH > 1
+           && lhs.origin_nodes_ == rhs.origin_nodes_
+#else
+           && lhs.origin_node() == rhs.origin_node()
+#endif
+           && lhs.launch_clock_domain_ == rhs.launch_clock_domain_
+           && lhs.capture_clock_domain_ == rhs.capture_clock_domain_
+           && lhs.domain_pair_ == rhs.domain_pair_
+           && lhs.type_ == rhs.type_;
 }
 
 inline bool operator!=(const TimingTag& lhs, const TimingTag& rhs) {
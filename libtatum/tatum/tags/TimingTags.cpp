@@ -3,6 +3,8 @@
 #include "tatum/error.hpp"
 namespace tatum {
 
+constexpr size_t TimingTags::MAX_CAPACITY;
+
 /*
  * Tag utilities
  */
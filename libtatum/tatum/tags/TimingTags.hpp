@@ -20,10 +20,17 @@ namespace tatum {
  * Implementation
  * ====================
  * Since each node in the timing graph typically has only a few tags (usually 1 or 2), we
- * perform linear searches to find match tags and tag ranges.
+ * perform linear searches to find match tags and tag ranges. Tags with a domain pair id
+ * (data required and slack tags, see TimingTag::domain_pair()) are matched by comparing
+ * only their pair ids, rather than each of their (possibly wildcard) domains.
  *
  * Note that to allow efficient iteration of tag ranges (by type) we ensure that tags of the
  * same type are adjacent in the storage vector (i.e. the vector is sorted by type)
+ *
+ * By default each set of tags owns its (heap allocated) storage. Alternately, the tags can be
+ * relocated into externally owned storage (e.g. a large block shared by all nodes, see
+ * CommonAnalysisOps::pack_tags()), which avoids a separate allocation per node. If more tags
+ * are later added than fit in the external storage, the tags move back to owned heap storage.
  */
 class TimingTags {
     public:
@@ -35,6 +42,9 @@ class TimingTags {
         constexpr static size_t DEFAULT_TAGS_TO_RESERVE = 3;
         constexpr static size_t GROWTH_FACTOR = 2;
 
+        //The most tags which can be stored (limited by the width of capacity_)
+        constexpr static size_t MAX_CAPACITY = (1 << 15) - 1;
+
     public:
 
         typedef Iterator<TimingTag> iterator;
@@ -50,7 +60,7 @@ class TimingTags {
         TimingTags(const TimingTags&);
         TimingTags(TimingTags&&);
         TimingTags& operator=(TimingTags);
-        ~TimingTags() = default;
+        ~TimingTags();
         friend void swap(TimingTags& lhs, TimingTags& rhs);
 
         /*
@@ -98,9 +108,32 @@ class TimingTags {
         ///\remark Finds (or creates) the tag with the same clock domain as base_tag and update the required time if new_time is smaller
         bool min(const Time& new_time, const NodeId origin, const TimingTag& base_tag, bool arr_must_be_valid=false);
 
+        ///Updates the times of this set of tags to be the maximum of each of src_tags (offset by delay).
+        ///\param src_tags The tags to merge (all of the same type)
+        ///\param delay The delay added to the time of each tag in src_tags
+        ///\param origin The origin node of the merged times
+        ///\remark Equivalent to calling max() for each tag in src_tags, but locates the tags of the
+        ///        matching type only once for the whole range
+        bool max(tag_range src_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid=false);
+
+        ///Updates the times of this set of tags to be the minimum of each of src_tags (offset by delay).
+        ///\see max(tag_range, const Time&, const NodeId, bool)
+        bool min(tag_range src_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid=false);
+
+        ///Removes the specified tag from the current set
+        ///\param iter An iterator to the tag to remove
+        ///\returns An iterator to the tag which followed the removed tag
+        iterator remove_tag(iterator iter);
+
         ///Clears the tags in the current set
         void clear();
 
+        ///Moves the tags into the externally owned storage, which must have space for at least size() tags.
+        ///The storage must remain valid until this object is destroyed, or the tags are relocated again.
+        ///\param storage The storage to use
+        ///\param storage_capacity The number of tags which fit in storage
+        void relocate(TimingTag* storage, size_t storage_capacity);
+
     public:
 
         //Iterator definition
@@ -171,20 +204,31 @@ class TimingTags {
 
         ///Finds a TimingTag in the current set that matches the launch and capture clocks of tag
         ///\returns An iterator to the tag if found, or end(type) if not found
-        iterator find_matching_tag(TagType type, DomainId launch_domain, DomainId capture_domain);
+        iterator find_matching_tag(TagType type, DomainId launch_domain, DomainId capture_domain, DomainPairId domain_pair);
+
+        ///Finds the first TimingTag in the range [b, e) that matches the launch and capture clocks.
+        ///If both domain_pair and a tag's pair are valid only the pair ids are compared.
+        ///\returns An iterator to the tag if found, or e if not found
+        static iterator find_matching_tag(iterator b, iterator e, DomainId launch_domain, DomainId capture_domain, DomainPairId domain_pair);
+
+        ///Merges each tag of src_tags (offset by delay) into the matching tag of this set using merge_tag,
+        ///adding any tags without a match
+        template<class MergeOp>
+        bool merge_range(tag_range src_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid, MergeOp merge_tag);
 
         ///Find a TimingTag matching the specified DATA_REQUIRED tag provided there is 
         //a valid associated DATA_ARRIVAL tag
         ///\returns A a pair of bool and iterator. The bool indicates if a valid arrival was found, 
         ///         the iterator is the required tag matching launch and capture which has a valid 
         //          corresponding arrival time, or end(TagType::DATA_REQUIRED)
-        std::pair<bool,iterator> find_data_required_with_valid_data_arrival(DomainId launch_domain, DomainId capture_domain);
+        std::pair<bool,iterator> find_data_required_with_valid_data_arrival(DomainId launch_domain, DomainId capture_domain, DomainPairId domain_pair);
 
 
         iterator insert(iterator iter, const TimingTag& tag);
         void grow_insert(size_t index, const TimingTag& tag);
 
         void increment_size(TagType type);
+        void decrement_size(TagType type);
 
 
     private:
@@ -193,19 +237,20 @@ class TimingTags {
         //to be packed down to 16 bytes (8 for counters, 8 for pointer)
         //
         //In its current configuration we can store at most:
-        //  65536           total tags (size_ and capacity_)
-        //  256             clock launch tags (num_clock_launch_tags_)
-        //  256             clock capture tags (num_clock_capture_tags_)
-        //  256             data arrival tags (num_data_arrival_tags_)
-        //  256             data required tags (num_data_required_tags_)
-        //  (65536 - 4*256) slack tags (size_ - num_*)
-        unsigned short size_ = 0;
-        unsigned short capacity_ = 0;
-        unsigned char num_clock_launch_tags_ = 0;
-        unsigned char num_clock_capture_tags_ = 0;
-        unsigned char num_data_arrival_tags_ = 0;
-        unsigned char num_data_required_tags_ = 0;
-        std::unique_ptr<TimingTag[]> tags_;
+        //  32767           total tags (capacity_, see MAX_CAPACITY, which also bounds size_)
+        //  255             clock launch tags (num_clock_launch_tags_)
+        //  255             clock capture tags (num_clock_capture_tags_)
+        //  255             data arrival tags (num_data_arrival_tags_)
+        //  255             data required tags (num_data_required_tags_)
+        //  (32767 - 4*255) slack tags (size_ - num_*)
+        unsigned short size_;
+        unsigned short capacity_ : 15;
+        unsigned short external_storage_ : 1; //True if tags_ is owned by someone else (and must not be freed)
+        unsigned char num_clock_launch_tags_;
+        unsigned char num_clock_capture_tags_;
+        unsigned char num_data_arrival_tags_;
+        unsigned char num_data_required_tags_;
+        TimingTag* tags_;
 
 };
 
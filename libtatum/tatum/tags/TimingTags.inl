@@ -1,5 +1,7 @@
 #include <algorithm>
+#include <string>
 #include "tatum/util/tatum_assert.hpp"
+#include "tatum/error.hpp"
 
 namespace tatum {
 
@@ -13,22 +15,29 @@ namespace tatum {
 inline TimingTags::TimingTags(size_t num_reserve)
     : size_(0)
     , capacity_(num_reserve)
+    , external_storage_(false)
     , num_clock_launch_tags_(0)
     , num_clock_capture_tags_(0)
     , num_data_arrival_tags_(0)
     , num_data_required_tags_(0)
-    , tags_(capacity_ ? new TimingTag[capacity_] : nullptr)
-    {}
+    , tags_(capacity_ ? new TimingTag[capacity_] : nullptr) {
+    //Check the requested capacity was not truncated by capacity_'s bit-field
+    if (num_reserve > MAX_CAPACITY) {
+        delete[] tags_; //Not freed by the destructor when throwing
+        throw tatum::Error("Too many timing tags reserved on a node (at most " + std::to_string(MAX_CAPACITY) + " are supported)");
+    }
+}
 
 inline TimingTags::TimingTags(const TimingTags& other) 
     : size_(other.size())
     , capacity_(size_)
+    , external_storage_(false)
     , num_clock_launch_tags_(other.num_clock_launch_tags_)
     , num_clock_capture_tags_(other.num_clock_capture_tags_)
     , num_data_arrival_tags_(other.num_data_arrival_tags_)
     , num_data_required_tags_(other.num_data_required_tags_)
     , tags_(capacity_ ? new TimingTag[capacity_] : nullptr) {
-    std::copy(other.tags_.get(), other.tags_.get() + other.size(), tags_.get());
+    std::copy(other.tags_, other.tags_ + other.size(), tags_);
 }
 
 inline TimingTags::TimingTags(TimingTags&& other)
@@ -41,18 +50,24 @@ inline TimingTags& TimingTags::operator=(TimingTags other) {
     return *this;
 }
 
+inline TimingTags::~TimingTags() {
+    if (!external_storage_) {
+        delete[] tags_;
+    }
+}
+
 inline size_t TimingTags::size() const { 
     return size_;
 }
 
 inline TimingTags::iterator TimingTags::begin() {
-    auto iter = iterator(tags_.get());
+    auto iter = iterator(tags_);
 
     return iter;
 }
 
 inline TimingTags::const_iterator TimingTags::begin() const {
-    return const_iterator(tags_.get());
+    return const_iterator(tags_);
 }
 
 inline TimingTags::iterator TimingTags::begin(TagType type) {
@@ -90,8 +105,8 @@ inline TimingTags::iterator TimingTags::end() {
 }
 
 inline TimingTags::const_iterator TimingTags::end() const {
-    auto iter = const_iterator(tags_.get() + size_);
-    TATUM_ASSERT_SAFE(iter.p_ >= tags_.get() && iter.p_ <= tags_.get() + size());
+    auto iter = const_iterator(tags_ + size_);
+    TATUM_ASSERT_SAFE(iter.p_ >= tags_ && iter.p_ <= tags_ + size());
     return iter;
 }
 
@@ -123,7 +138,7 @@ inline TimingTags::const_iterator TimingTags::end(TagType type) const {
         default:
             TATUM_ASSERT_MSG(false, "Invalid tag type");
     }
-    TATUM_ASSERT_SAFE(iter.p_ >= tags_.get() && iter.p_ <= tags_.get() + size());
+    TATUM_ASSERT_SAFE(iter.p_ >= tags_ && iter.p_ <= tags_ + size());
     return iter;
 }
 
@@ -228,6 +243,76 @@ inline bool TimingTags::min(const Time& new_time, const NodeId origin, const Tim
     return modified;
 }
 
+inline bool TimingTags::max(tag_range src_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid) {
+    auto merge_max = [](TimingTag& tag, const Time& new_time, const NodeId new_origin, const TimingTag& base_tag) {
+        return tag.max(new_time, new_origin, base_tag);
+    };
+    return merge_range(src_tags, delay, origin, arr_must_be_valid, merge_max);
+}
+
+inline bool TimingTags::min(tag_range src_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid) {
+    auto merge_min = [](TimingTag& tag, const Time& new_time, const NodeId new_origin, const TimingTag& base_tag) {
+        return tag.min(new_time, new_origin, base_tag);
+    };
+    return merge_range(src_tags, delay, origin, arr_must_be_valid, merge_min);
+}
+
+template<class MergeOp>
+inline bool TimingTags::merge_range(tag_range src_tags, const Time& delay, const NodeId origin, bool arr_must_be_valid, MergeOp merge_tag) {
+    if (src_tags.empty()) return false;
+
+    bool modified = false;
+
+    //All the source tags are of the same type, so we only need to locate the
+    //matching tags once (rather than once per source tag, as max()/min() would).
+    //Note the range only changes if a new tag is added.
+    TagType type = src_tags.begin()->type();
+    iterator b = begin(type);
+    iterator e = end(type);
+
+    for (const TimingTag& src_tag : src_tags) {
+        TATUM_ASSERT_SAFE(src_tag.type() == type);
+
+        iterator iter;
+        if (arr_must_be_valid) {
+            auto bool_iter = find_data_required_with_valid_data_arrival(src_tag.launch_clock_domain(), src_tag.capture_clock_domain(), src_tag.domain_pair());
+            if (!bool_iter.first) continue; //No valid arrival
+
+            iter = bool_iter.second;
+        } else {
+            iter = find_matching_tag(b, e, src_tag.launch_clock_domain(), src_tag.capture_clock_domain(), src_tag.domain_pair());
+        }
+
+        Time new_time = src_tag.time() + delay;
+        if (iter == e) {
+            //First time we've seen this domain
+            modified |= add_tag(TimingTag(new_time, origin, src_tag));
+
+            //Adding the tag may have moved the tags
+            b = begin(type);
+            e = end(type);
+        } else {
+            modified |= merge_tag(*iter, new_time, origin, src_tag);
+        }
+    }
+
+    return modified;
+}
+
+inline TimingTags::iterator TimingTags::remove_tag(iterator iter) {
+    size_t index = std::distance(begin(), iter);
+    TATUM_ASSERT(index < size());
+
+    TagType type = iter->type();
+
+    //Shift everything after index one position left (keeping the tags sorted by type)
+    std::copy(tags_ + index + 1, tags_ + size(), tags_ + index);
+
+    decrement_size(type);
+
+    return begin() + index;
+}
+
 inline void TimingTags::clear() {
     size_ = 0;
     num_clock_launch_tags_ = 0;
@@ -236,22 +321,49 @@ inline void TimingTags::clear() {
     num_data_required_tags_ = 0;
 }
 
+inline void TimingTags::relocate(TimingTag* storage, size_t storage_capacity) {
+    TATUM_ASSERT(storage_capacity >= size());
+    TATUM_ASSERT(storage_capacity <= MAX_CAPACITY);
+
+    std::copy_n(tags_, size(), storage);
+
+    if (!external_storage_) {
+        delete[] tags_;
+    }
+
+    tags_ = storage;
+    capacity_ = storage_capacity;
+    external_storage_ = true;
+}
+
 inline std::pair<bool,TimingTags::iterator> TimingTags::find_matching_tag(const TimingTag& tag, bool arr_must_be_valid) {
     if(arr_must_be_valid) {
         TATUM_ASSERT(tag.type() == TagType::DATA_REQUIRED);
-        auto bool_iter = find_data_required_with_valid_data_arrival(tag.launch_clock_domain(), tag.capture_clock_domain());
+        auto bool_iter = find_data_required_with_valid_data_arrival(tag.launch_clock_domain(), tag.capture_clock_domain(), tag.domain_pair());
         return bool_iter;
     } else {
-        auto iter = find_matching_tag(tag.type(), tag.launch_clock_domain(), tag.capture_clock_domain());
+        auto iter = find_matching_tag(tag.type(), tag.launch_clock_domain(), tag.capture_clock_domain(), tag.domain_pair());
         return {true, iter};
     }
 }
 
-inline TimingTags::iterator TimingTags::find_matching_tag(TagType type, DomainId launch_domain, DomainId capture_domain) {
+inline TimingTags::iterator TimingTags::find_matching_tag(TagType type, DomainId launch_domain, DomainId capture_domain, DomainPairId domain_pair) {
+    return find_matching_tag(begin(type), end(type), launch_domain, capture_domain, domain_pair);
+}
+
+inline TimingTags::iterator TimingTags::find_matching_tag(iterator b, iterator e, DomainId launch_domain, DomainId capture_domain, DomainPairId domain_pair) {
     //Linear search for matching tag
-    auto b = begin(type);
-    auto e = end(type);
     for(auto iter = b; iter != e; ++iter) {
+        if(domain_pair && iter->domain_pair()) {
+            //Both fully specified, so the pairs match exactly if their ids do
+            TATUM_ASSERT_SAFE((iter->domain_pair() == domain_pair) == (   iter->launch_clock_domain() == launch_domain
+                                                                       && iter->capture_clock_domain() == capture_domain));
+            if(iter->domain_pair() == domain_pair) {
+                return iter;
+            }
+            continue;
+        }
+
         bool match_launch =    !launch_domain               //Search wildcard
                             || !iter->launch_clock_domain() //Match wildcard
                             || launch_domain == iter->launch_clock_domain(); //Exact match
@@ -267,16 +379,16 @@ inline TimingTags::iterator TimingTags::find_matching_tag(TagType type, DomainId
     return e;
 }
 
-inline std::pair<bool,TimingTags::iterator> TimingTags::find_data_required_with_valid_data_arrival(DomainId launch_domain, DomainId capture_domain) {
+inline std::pair<bool,TimingTags::iterator> TimingTags::find_data_required_with_valid_data_arrival(DomainId launch_domain, DomainId capture_domain, DomainPairId domain_pair) {
     //Look for the matching arrival
-    auto arr_iter = find_matching_tag(TagType::DATA_ARRIVAL, launch_domain, DomainId::INVALID());
+    auto arr_iter = find_matching_tag(TagType::DATA_ARRIVAL, launch_domain, DomainId::INVALID(), DomainPairId::INVALID());
     if(arr_iter == end(TagType::DATA_ARRIVAL) || !arr_iter->time().valid()) {
         //No valid arrival
         return {false, end(TagType::DATA_REQUIRED)};
     }
 
     //Find the matching required
-    return {true, find_matching_tag(TagType::DATA_REQUIRED, launch_domain, capture_domain)};
+    return {true, find_matching_tag(TagType::DATA_REQUIRED, launch_domain, capture_domain, domain_pair)};
 }
 
 inline size_t TimingTags::capacity() const { return capacity_; }
@@ -309,15 +421,21 @@ inline TimingTags::iterator TimingTags::insert(iterator iter, const TimingTag& t
 }
 
 inline void TimingTags::grow_insert(size_t index, const TimingTag& tag) {
-    size_t new_capacity = (capacity() == 0) ? 1 : GROWTH_FACTOR * capacity();
+    if (capacity() == MAX_CAPACITY) {
+        throw tatum::Error("Too many timing tags on a node (at most " + std::to_string(MAX_CAPACITY) + " are supported)");
+    }
+
+    //Note that growth is clamped so the new capacity still fits in capacity_
+    size_t new_capacity = (capacity() == 0) ? 1 : std::min(GROWTH_FACTOR * capacity(), MAX_CAPACITY);
 
     //We construct a new copy of ourselves at the new capacity and with the new
     //tag inserted
     TimingTags new_tags(new_capacity);
 
-    std::copy_n(tags_.get(), index, new_tags.tags_.get()); //Copy before index
+    //Note that if we were using external storage, new_tags switches us back to owned storage
+    std::copy_n(tags_, index, new_tags.tags_); //Copy before index
     new_tags.tags_[index] = tag; //Insert the new value
-    std::copy_n(tags_.get() + index, size() - index, new_tags.tags_.get() + index + 1); //Copy after index
+    std::copy_n(tags_ + index, size() - index, new_tags.tags_ + index + 1); //Copy after index
 
     //Copy the sizes
     new_tags.size_ = size_;
@@ -356,6 +474,30 @@ inline void TimingTags::increment_size(TagType type) {
     }
 }
 
+inline void TimingTags::decrement_size(TagType type) {
+    TATUM_ASSERT(size_ > 0);
+    --size_;
+    switch(type) {
+        case TagType::CLOCK_LAUNCH: 
+            --num_clock_launch_tags_;
+            break;
+        case TagType::CLOCK_CAPTURE: 
+            --num_clock_capture_tags_;
+            break;
+        case TagType::DATA_ARRIVAL: 
+            --num_data_arrival_tags_;
+            break;
+        case TagType::DATA_REQUIRED: 
+            --num_data_required_tags_;
+            break;
+        case TagType::SLACK: 
+            //Pass
+            break;
+        default:
+            TATUM_ASSERT_MSG(false, "Invalid tag type");
+    }
+}
+
 inline void swap(TimingTags& lhs, TimingTags& rhs) {
     std::swap(lhs.tags_, rhs.tags_);
     std::swap(lhs.num_clock_launch_tags_, rhs.num_clock_launch_tags_);
@@ -363,7 +505,15 @@ inline void swap(TimingTags& lhs, TimingTags& rhs) {
     std::swap(lhs.num_data_arrival_tags_, rhs.num_data_arrival_tags_);
     std::swap(lhs.num_data_required_tags_, rhs.num_data_required_tags_);
     std::swap(lhs.size_, rhs.size_);
-    std::swap(lhs.capacity_, rhs.capacity_);
+
+    //Can't std::swap() bit-fields
+    unsigned short lhs_capacity = lhs.capacity_;
+    lhs.capacity_ = rhs.capacity_;
+    rhs.capacity_ = lhs_capacity;
+
+    bool lhs_external_storage = lhs.external_storage_;
+    lhs.external_storage_ = rhs.external_storage_;
+    rhs.external_storage_ = lhs_external_storage;
 }
 
 } //namepsace
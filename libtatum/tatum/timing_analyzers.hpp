@@ -175,6 +175,9 @@
  * which falls off (derates less) along deeper paths.  It is also possible for the derate to take
  * into account the physical locality/spread of a path.
  *
+ * Note: Fixed and depth-based derating of clock and data paths are now implemented
+ *       (see TimingDerate and TimingAnalyzer::set_timing_derate()).
+ *
  * Common Clock Pessimism Removal (CCPR)
  * ---------------------------------------
  * Note: Names for this vary, including: Clock Reconvergence Pessimism Removal (CRPR),
@@ -188,6 +191,9 @@
  *
  * CCPR does not directly remove this effect, but instead calculates a 'credit' which is
  * added back to the final path to counter-act this extra pessimism.
+ *
+ * Note: Block-based CCPR is now implemented (see CommonClockIndex and
+ *       TimingAnalyzer::set_common_clock_pessimism_removal()).
  */
 
 /*
@@ -18,7 +18,8 @@ TimingPath trace_path(const TimingGraph& timing_graph,
 
 std::vector<TimingPathInfo> find_critical_paths(const TimingGraph& timing_graph, 
                                                 const TimingConstraints& timing_constraints, 
-                                                const SetupTimingAnalyzer& setup_analyzer) {
+                                                const SetupTimingAnalyzer& setup_analyzer,
+                                                size_t corner) {
     std::vector<TimingPathInfo> cpds;
 
     //We calculate the critical path delay (CPD) for each pair of clock domains (which are connected to each other)
@@ -42,7 +43,7 @@ std::vector<TimingPathInfo> find_critical_paths(const TimingGraph& timing_graph,
 
         //Look at each data arrival
         for(TimingTag slack_tag : setup_analyzer.setup_slacks(node)) {
-            Time slack = slack_tag.time();
+            Time slack = Time(slack_tag.time().value(corner));
             if(!slack.valid()) {
                 throw Error("slack is not valid", node);
             }
@@ -88,9 +89,11 @@ TimingPath trace_setup_path(const TimingGraph& timing_graph,
                             const SetupTimingAnalyzer& setup_analyzer,
                             const DomainId launch_domain,
                             const DomainId capture_domain,
-                            const NodeId sink_node) {
+                            const NodeId sink_node,
+                            size_t corner) {
 
-    detail::SetupTagRetriever tag_retriever(setup_analyzer);
+    detail::SetupTagRetriever setup_tag_retriever(setup_analyzer);
+    detail::CornerTagRetriever tag_retriever(timing_graph, setup_tag_retriever, corner);
     return detail::trace_path(timing_graph, tag_retriever, launch_domain, capture_domain, sink_node);
 }
 
@@ -98,9 +101,11 @@ TimingPath trace_hold_path(const TimingGraph& timing_graph,
                            const HoldTimingAnalyzer& hold_analyzer,
                            const DomainId launch_domain,
                            const DomainId capture_domain,
-                           const NodeId sink_node) {
+                           const NodeId sink_node,
+                           size_t corner) {
 
-    detail::HoldTagRetriever tag_retriever(hold_analyzer);
+    detail::HoldTagRetriever hold_tag_retriever(hold_analyzer);
+    detail::CornerTagRetriever tag_retriever(timing_graph, hold_tag_retriever, corner);
     return detail::trace_path(timing_graph, tag_retriever, launch_domain, capture_domain, sink_node);
 }
 
@@ -9,21 +9,26 @@
 
 namespace tatum {
 
+//Note that with multiple timing corners (see Time) the following report the specified corner
+
 std::vector<TimingPathInfo> find_critical_paths(const TimingGraph& timing_graph, 
                                                 const TimingConstraints& timing_constraints, 
-                                                const SetupTimingAnalyzer& setup_analyzer);
+                                                const SetupTimingAnalyzer& setup_analyzer,
+                                                size_t corner=0);
 
 TimingPath trace_setup_path(const TimingGraph& timing_graph, 
                             const SetupTimingAnalyzer& setup_analyzer,
                             const DomainId launch_domain,
                             const DomainId capture_domain,
-                            const NodeId sink_node);
+                            const NodeId sink_node,
+                            size_t corner=0);
 
 TimingPath trace_hold_path(const TimingGraph& timing_graph, 
                            const HoldTimingAnalyzer& hold_analyzer,
                            const DomainId launch_domain,
                            const DomainId capture_domain,
-                           const NodeId sink_node);
+                           const NodeId sink_node,
+                           size_t corner=0);
 
 } //namespace
 #endif
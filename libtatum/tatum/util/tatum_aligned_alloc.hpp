@@ -0,0 +1,66 @@
+#ifndef TATUM_ALIGNED_ALLOC_HPP
+#define TATUM_ALIGNED_ALLOC_HPP
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace tatum { namespace util {
+
+//Allocation of over-aligned types (e.g. Time with multiple corners, see TIME_MEM_ALIGN).
+//
+//Prior to C++17 neither new nor std::allocator respect alignments larger than
+//alignof(std::max_align_t). Such allocations are instead padded by Align bytes,
+//and the address of the underlying allocation stored just before the aligned block.
+//Allocations which need no extra alignment are passed straight to ::operator new.
+template<size_t Align>
+void* aligned_new(size_t size) {
+    static_assert((Align & (Align - 1)) == 0, "Alignment must be a power of two");
+    if (Align <= alignof(std::max_align_t)) {
+        return ::operator new(size);
+    }
+
+    //Since Align exceeds the alignment of raw, there are always at least
+    //alignof(std::max_align_t) bytes before the aligned block to store raw
+    void* raw = ::operator new(size + Align);
+    uintptr_t aligned = (reinterpret_cast<uintptr_t>(raw) + Align) & ~uintptr_t(Align - 1);
+    void* ptr = reinterpret_cast<void*>(aligned);
+    static_cast<void**>(ptr)[-1] = raw;
+    return ptr;
+}
+
+//Frees memory allocated by aligned_new() with the same alignment
+template<size_t Align>
+void aligned_delete(void* ptr) {
+    if (Align <= alignof(std::max_align_t) || !ptr) {
+        ::operator delete(ptr);
+    } else {
+        ::operator delete(static_cast<void**>(ptr)[-1]);
+    }
+}
+
+//A std allocator which respects the alignment of T
+template<class T>
+struct aligned_allocator {
+    typedef T value_type;
+
+    aligned_allocator() = default;
+    template<class U>
+    aligned_allocator(const aligned_allocator<U>&) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(aligned_new<alignof(T)>(n * sizeof(T))); }
+    void deallocate(T* ptr, size_t /*n*/) { aligned_delete<alignof(T)>(ptr); }
+};
+
+template<class T, class U>
+bool operator==(const aligned_allocator<T>&, const aligned_allocator<U>&) { return true; }
+
+template<class T, class U>
+bool operator!=(const aligned_allocator<T>&, const aligned_allocator<U>&) { return false; }
+
+template<class T>
+using aligned_vector = std::vector<T,aligned_allocator<T>>;
+
+}} //namespace
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef TATUM_CPU_DISPATCH_HPP
+#define TATUM_CPU_DISPATCH_HPP
+#include "tatum/Time.hpp"
+
+/*
+ * Runtime CPU dispatch
+ *
+ * With multiple timing corners (TIME_VEC_WIDTH > 1) the per-corner Time operations are
+ * simple loops which the compiler vectorizes for the instruction set being targeted.
+ * To make use of wider vector units without building a separate binary for each host,
+ * functions marked with TATUM_TARGET_CLONES (the edge relaxation kernels, which inline
+ * the Time and tag merge operations) are compiled for several instruction sets.
+ * The best supported version is selected (once, when the program is loaded) based on the
+ * host CPU's features.
+ *
+ * The number of corners (and hence the layout of Time) is still fixed at compile time.
+ * Only the instructions used to process them vary by host. Since FMA is not enabled,
+ * all versions produce identical results.
+ *
+ * Dispatch is only used with multiple corners (with a single corner there is nothing to
+ * vectorize, and it would prevent the kernels from being inlined), and can be disabled
+ * by defining TATUM_NO_CPU_DISPATCH.
+ */
+#if TIME_VEC_WIDTH > 1 && !defined(TATUM_NO_CPU_DISPATCH) \
+    && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && defined(__has_attribute)
+# if __has_attribute(target_clones)
+#  define TATUM_CPU_DISPATCH
+# endif
+#endif
+
+#ifdef TATUM_CPU_DISPATCH
+# define TATUM_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "sse4.2", "default")))
+#else
+# define TATUM_TARGET_CLONES
+#endif
+
+namespace tatum { namespace util {
+
+//Returns the instruction set used by TATUM_TARGET_CLONES functions on this host
+inline const char* cpu_dispatch_target() {
+#ifdef TATUM_CPU_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return "avx512f";
+    if (__builtin_cpu_supports("avx2")) return "avx2";
+    if (__builtin_cpu_supports("sse4.2")) return "sse4.2";
+#endif
+    return "default";
+}
+
+}} //namespace
+
+#endif
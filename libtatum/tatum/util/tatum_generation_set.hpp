@@ -0,0 +1,85 @@
+#ifndef TATUM_GENERATION_SET
+#define TATUM_GENERATION_SET
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "tatum_assert.hpp"
+
+namespace tatum { namespace util {
+
+//A set of linear keys K (see linear_map) which can be cleared in O(1) time.
+//
+//Each key is associated with a generation 'stamp', and a key is a member of the set
+//only if its stamp matches the set's current generation. Clearing the set simply
+//advances the current generation (implicitly removing all keys), rather than touching
+//every element. This makes generation_set well suited to membership tests which are
+//repeatedly filled and cleared, where only a small fraction of the possible keys are
+//inserted between clears (e.g. tracking which nodes were touched by an incremental update).
+//
+//Unlike a std::vector<bool> each key has its own (non bit-packed) storage, so different
+//keys may be inserted concurrently provided the set has already been sized to cover them
+//(i.e. with resize()) so that no re-allocation occurs.
+template<typename K>
+class generation_set {
+    public:
+        typedef uint32_t stamp_type;
+
+    public: //Accessors
+        bool contains(const K key) const {
+            if (size_t(key) < stamps_.size()) {
+                return stamps_[size_t(key)] == generation_;
+            }
+            return false; //Out of range, so not a member
+        }
+
+        //Returns the number of keys which can be inserted without re-sizing
+        std::size_t capacity() const { return stamps_.size(); }
+
+    public: //Mutators
+
+        //Inserts key into the set, returning true if it was not previously a member
+        bool insert(const K key) {
+            if (size_t(key) >= stamps_.size()) {
+                //Resize so key is in range
+                stamps_.resize(size_t(key) + 1, INVALID_STAMP);
+            }
+
+            if (stamps_[size_t(key)] == generation_) return false;
+
+            stamps_[size_t(key)] = generation_;
+            return true;
+        }
+
+        //Ensures keys in the range [0..n-1] can be inserted without re-sizing
+        void resize(size_t n) {
+            if (n > stamps_.size()) {
+                stamps_.resize(n, INVALID_STAMP);
+            }
+        }
+
+        //Removes all keys from the set (amortized O(1))
+        void clear() {
+            ++generation_;
+
+            if (generation_ == INVALID_STAMP) {
+                //The generation counter has wrapped-around, so older stamps may
+                //alias the new generation. Explicitly reset them (this happens
+                //only once every 2^32 clears)
+                std::fill(stamps_.begin(), stamps_.end(), INVALID_STAMP);
+                generation_ = INVALID_STAMP + 1;
+            }
+        }
+
+    private:
+        constexpr static stamp_type INVALID_STAMP = 0;
+
+        std::vector<stamp_type> stamps_;
+        stamp_type generation_ = INVALID_STAMP + 1;
+};
+
+template<typename K>
+constexpr typename generation_set<K>::stamp_type generation_set<K>::INVALID_STAMP;
+
+}} //namespace
+#endif
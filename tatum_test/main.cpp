@@ -19,11 +19,14 @@
 #include "tatum/TimingReporter.hpp"
 #include "tatum/report/NodeNumNameResolver.hpp"
 #include "tatum/timing_paths.hpp"
+#include "tatum/graph_visitors/CommonClockIndex.hpp"
 
 #include "tatum/delay_calc/FixedDelayCalculator.hpp"
+#include "tatum/delay_calc/CachingDelayCalculator.hpp"
 
 #include "tatum/report/graphviz_dot_writer.hpp"
 #include "tatum/base/sta_util.hpp"
+#include "tatum/util/tatum_cpu_dispatch.hpp"
 #include "tatum/echo_writer.hpp"
 
 #include "golden_reference.hpp"
@@ -70,12 +73,46 @@ struct Args {
     //for each serial incremental run
     float edge_change_prob = 0.01;
 
+    //How tags are invalidated during serial incremental runs
+    std::string incr_invalidation_policy = "edge";
+
+    //Perform an endpoint-only update (deferring the rest)
+    //part-way through each serial incremental run?
+    size_t incr_endpoint_first = 0;
+
+    //Invalidate only the edges whose delays actually changed
+    //(found by a TrackingDelayCalculator) in serial incremental runs?
+    size_t incr_track_delay_changes = 0;
+
+    //Analyze serial incremental runs with delays cached
+    //by a CachingDelayCalculator?
+    size_t incr_cache_delays = 0;
+
     //Number of parallel runs to perform
     size_t num_parallel_runs = 30;
 
+    //Cache the clock network in the full (serial/parallel) analyzers?
+    size_t cache_clock_network = 0;
+
+    //Prune dominated tags in the analyzers?
+    size_t prune_dominated_tags = 0;
+
+    //Slack threshold above which the (full) analyzers need not calculate exact slacks
+    //(NaN calculates all slacks exactly)
+    float slack_threshold = std::numeric_limits<float>::quiet_NaN();
+
     //Use unit delays instead of from file?
     float unit_delay = 0;
 
+    //Scale the delays of each additional timing corner (corner c is scaled by 1 + c*scale)
+    float corner_delay_scale = 0;
+
+    //Derate all edge delays by the specified factor (verified against an analysis of scaled delays)
+    float derate = 0;
+
+    //Perform common clock pessimism removal in the analyzers?
+    size_t cppr = 0;
+
     //Write an echo file of resutls?
     std::string write_echo;
 
@@ -127,6 +164,22 @@ double arithmean_skip_first(T values) {
     return arithmean(std::begin(values) + 1, std::end(values));
 }
 
+//Constructs an analyzer of the specified analysis type ("setup", "hold" or "setuphold")
+template<class GraphWalker=tatum::SerialWalker, class DelayCalc=tatum::DelayCalculator>
+std::shared_ptr<tatum::TimingAnalyzer> make_analyzer(const std::string& analysis_type,
+                                                     const tatum::TimingGraph& timing_graph,
+                                                     const tatum::TimingConstraints& timing_constraints,
+                                                     const DelayCalc& delay_calc) {
+    if (analysis_type == "setuphold") {
+        return tatum::AnalyzerFactory<tatum::SetupHoldAnalysis,GraphWalker,DelayCalc>::make(timing_graph, timing_constraints, delay_calc);
+    } else if (analysis_type == "setup") {
+        return tatum::AnalyzerFactory<tatum::SetupAnalysis,GraphWalker,DelayCalc>::make(timing_graph, timing_constraints, delay_calc);
+    } else {
+        TATUM_ASSERT(analysis_type == "hold");
+        return tatum::AnalyzerFactory<tatum::HoldAnalysis,GraphWalker,DelayCalc>::make(timing_graph, timing_constraints, delay_calc);
+    }
+}
+
 template<class T>
 double median_skip_first(T values) {
     return median(std::begin(values) + 1, std::end(values));
@@ -155,9 +208,52 @@ void usage(std::string prog) {
     cout << "                                               (default " << default_args.num_parallel_runs << ")\n";
     cout << "    --edge_change_prob EDGE_CHANGE_PROB:       Probability of an edge delay changing in a serial incremental run\n";
     cout << "                                               (default " << default_args.edge_change_prob << ")\n";
+    cout << "    --incr_invalidation_policy POLICY:         How tags are invalidated in a serial incremental run\n";
+    cout << "                                               'edge', 'block', or 'adaptive'\n";
+    cout << "                                               (default " << default_args.incr_invalidation_policy << ")\n";
+    cout << "    --incr_endpoint_first ENDPOINT_FIRST:      Perform an endpoint-only timing update part-way through\n";
+    cout << "                                               each serial incremental run.\n";
+    cout << "                                               0 implies no, non-zero implies yes.\n";
+    cout << "                                               (default " << default_args.incr_endpoint_first << ")\n";
+    cout << "    --incr_track_delay_changes TRACK:          Invalidate only edges whose delays actually changed\n";
+    cout << "                                               in each serial incremental run.\n";
+    cout << "                                               0 implies no, non-zero implies yes.\n";
+    cout << "                                               (default " << default_args.incr_track_delay_changes << ")\n";
+    cout << "    --incr_cache_delays CACHE_DELAYS:          Cache the edge delays used in each serial incremental run,\n";
+    cout << "                                               re-calculating only those of invalidated edges.\n";
+    cout << "                                               0 implies no, non-zero implies yes.\n";
+    cout << "                                               (default " << default_args.incr_cache_delays << ")\n";
+    cout << "    --cache_clock_network CACHE_CLOCK:         Calculate the clock network once in the serial/parallel\n";
+    cout << "                                               analyzers, re-using it until a clock edge is invalidated.\n";
+    cout << "                                               0 implies no, non-zero implies yes.\n";
+    cout << "                                               (default " << default_args.cache_clock_network << ")\n";
+    cout << "    --prune_dominated_tags PRUNE_TAGS:         Prune tags which can not determine endpoint worst slacks.\n";
+    cout << "                                               Only endpoint worst slacks are then verified.\n";
+    cout << "                                               0 implies no, non-zero implies yes.\n";
+    cout << "                                               (default " << default_args.prune_dominated_tags << ")\n";
+    cout << "    --slack_threshold SLACK_THRESHOLD:         Slack above which the serial/parallel analyzers only\n";
+    cout << "                                               calculate lower bounds on slack.\n";
+    cout << "                                               nan implies all slacks are exact.\n";
+    cout << "                                               (default " << default_args.slack_threshold << ")\n";
     cout << "    --unit_delay UNIT_DELAY:                   Use specified unit delay for all edges.\n";
     cout << "                                               0 uses delay model from input.\n";
     cout << "                                               (default " << default_args.unit_delay << ")\n";
+    cout << "    --corner_delay_scale SCALE:                Scale the delays of timing corner c by (1 + c*SCALE).\n";
+    cout << "                                               Only corner 0 is verified against the golden reference,\n";
+    cout << "                                               other corners are verified against a separate analysis.\n";
+    cout << "                                               (default " << default_args.corner_delay_scale << ", " << tatum::Time::num_corners() << " corners)\n";
+    cout << "    --derate DERATE:                           Verify an analysis with all edge delays derated by DERATE\n";
+    cout << "                                               against an analysis of equivalently scaled delays.\n";
+    cout << "                                               0 implies no derating.\n";
+    cout << "                                               (default " << default_args.derate << ")\n";
+    cout << "    --cppr CPPR:                               Perform common clock pessimism removal.\n";
+    cout << "                                               Verified against the golden reference, so only\n";
+    cout << "                                               valid without early/late source latency differences.\n";
+    cout << "                                               With DERATE, also verifies that the slacks with\n";
+    cout << "                                               an early/late clock derate lie between those with\n";
+    cout << "                                               and without the derate.\n";
+    cout << "                                               0 implies no, non-zero implies yes.\n";
+    cout << "                                               (default " << default_args.cppr << ")\n";
     cout << "    --write_echo WRITE_ECHO:                   Write an echo file of restuls.\n";
     cout << "                                               empty implies no, non-empty implies write to specified file.\n";
     cout << "                                               (default " << default_args.write_echo << ")\n";
@@ -210,6 +306,8 @@ Args parse_args(int argc, char** argv) {
                 args.write_echo = argv[i+1];
             } else if (arg_str == "--analysis_type") {
                 args.analysis_type = argv[i+1];
+            } else if (arg_str == "--incr_invalidation_policy") {
+                args.incr_invalidation_policy = argv[i+1];
             } else {
 
                 std::istringstream ss(argv[i+1]);
@@ -231,8 +329,26 @@ Args parse_args(int argc, char** argv) {
                     args.num_parallel_runs = arg_val;
                 } else if (argv[i] == std::string("--edge_change_prob")) { 
                     args.edge_change_prob = arg_val;
+                } else if (argv[i] == std::string("--incr_endpoint_first")) { 
+                    args.incr_endpoint_first = arg_val;
+                } else if (argv[i] == std::string("--incr_track_delay_changes")) { 
+                    args.incr_track_delay_changes = arg_val;
+                } else if (argv[i] == std::string("--incr_cache_delays")) { 
+                    args.incr_cache_delays = arg_val;
+                } else if (argv[i] == std::string("--cache_clock_network")) { 
+                    args.cache_clock_network = arg_val;
+                } else if (argv[i] == std::string("--prune_dominated_tags")) { 
+                    args.prune_dominated_tags = arg_val;
+                } else if (argv[i] == std::string("--slack_threshold")) { 
+                    args.slack_threshold = arg_val;
                 } else if (argv[i] == std::string("--unit_delay")) { 
                     args.unit_delay = arg_val;
+                } else if (argv[i] == std::string("--corner_delay_scale")) { 
+                    args.corner_delay_scale = arg_val;
+                } else if (argv[i] == std::string("--derate")) { 
+                    args.derate = arg_val;
+                } else if (argv[i] == std::string("--cppr")) { 
+                    args.cppr = arg_val;
                 } else if (argv[i] == std::string("--opt_graph_layout")) { 
                     args.opt_graph_layout = arg_val;
                 } else if (argv[i] == std::string("--verify")) { 
@@ -267,6 +383,12 @@ Args parse_args(int argc, char** argv) {
         cmd_error(prog, "Missing required positional argument 'tg_file'");
     }
 
+    if (args.analysis_type != "setuphold" && args.analysis_type != "setup" && args.analysis_type != "hold") {
+        std::stringstream msg;
+        msg << "Unrecognized analysis type '" << args.analysis_type << "'";
+        cmd_error(prog, msg.str());
+    }
+
     return args;
 }
 
@@ -274,6 +396,14 @@ int main(int argc, char** argv) {
 
     Args args = parse_args(argc, argv);
 
+#ifdef TATUM_NO_TAG_ORIGINS
+    if (args.report) {
+        //Reports require tracing timing paths, which needs the tag origin nodes
+        cout << "Note: Timing tags do not track origin nodes, reports disabled" << endl;
+        args.report = 0;
+    }
+#endif
+
     int exit_code = 0;
 
     struct timespec prog_start, load_start, opt_start, verify_start;
@@ -284,6 +414,12 @@ int main(int argc, char** argv) {
     if (args.print_sizes) {
         cout << "Time class sizeof  = " << sizeof(Time) << " bytes. Time Vec Width: " << TIME_VEC_WIDTH << endl;
         cout << "Time class alignof = " << alignof(Time) << endl;
+#ifdef TATUM_FIXED_POINT_TIME
+        cout << "Time is fixed-point: " << sizeof(Time::tick_type) << " byte ticks of " << TATUM_FIXED_POINT_TIME_RESOLUTION << " sec" << endl;
+#endif
+#ifdef TATUM_CPU_DISPATCH
+        cout << "Time kernels dispatched for: " << tatum::util::cpu_dispatch_target() << endl;
+#endif
 
         cout << "TimingTag class sizeof  = " << sizeof(TimingTag) << " bytes." << endl;
         cout << "TimingTag class alignof = " << alignof(TimingTag) << " bytes." << endl;
@@ -348,6 +484,9 @@ int main(int argc, char** argv) {
         } else {
             delay_calculator = loader.delay_calculator();
         }
+        if (args.corner_delay_scale != 0.) {
+            scale_corner_delays(*timing_graph, *delay_calculator, args.corner_delay_scale);
+        }
         golden_reference = loader.golden_reference();
 
         clock_gettime(CLOCK_MONOTONIC, &load_end);
@@ -372,11 +511,14 @@ int main(int argc, char** argv) {
         clock_gettime(CLOCK_MONOTONIC, &opt_end);
         cout << "Optimizing graph took: " << tatum::time_sec(opt_start, opt_end) << " sec" << endl;
 
-        remap_delay_calculator(*timing_graph, *delay_calculator, id_maps.edge_id_map);
+        delay_calculator->remap_edges(id_maps.edge_id_map);
         timing_constraints->remap_nodes(id_maps.node_id_map);
         golden_reference->remap_nodes(id_maps.node_id_map);
     }
 
+    //All constraints have been specified
+    timing_constraints->freeze();
+
     /*
      *timing_constraints->print();
      */
@@ -413,25 +555,38 @@ int main(int argc, char** argv) {
     std::shared_ptr<tatum::TimingAnalyzer> hold_analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis>::make(*timing_graph, *timing_constraints, *delay_calculator);
     std::shared_ptr<tatum::TimingAnalyzer> setup_hold_analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis>::make(*timing_graph, *timing_constraints, *delay_calculator);
 
+    //The common clock index depends only on the graph and clock sources,
+    //so is built once and shared by the analyzers performing CPPR
+    std::shared_ptr<const tatum::CommonClockIndex> common_clock_index;
+    if (args.cppr) {
+        common_clock_index = std::make_shared<tatum::CommonClockIndex>(*timing_graph, *timing_constraints);
+    }
+
     //Create the timing analyzer
-    std::shared_ptr<tatum::TimingAnalyzer> serial_analyzer;
-    if (args.analysis_type == "setuphold") {
-        serial_analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis>::make(*timing_graph, *timing_constraints, *delay_calculator);
-    } else if (args.analysis_type == "setup") {
-        serial_analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis>::make(*timing_graph, *timing_constraints, *delay_calculator);
-    } else if (args.analysis_type == "hold") {
-        serial_analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis>::make(*timing_graph, *timing_constraints, *delay_calculator);
-    } else {
-        std::stringstream ss;
-        ss << "Unrecognized analysis type '" << args.analysis_type << "'";
-        cmd_error(argv[0], ss.str());
+    //
+    //The serial and parallel analyzers are specialized on the concrete delay calculator type
+    //(so delay lookups are inlined), while the others use the generic DelayCalculator interface
+    std::shared_ptr<tatum::TimingAnalyzer> serial_analyzer = make_analyzer<tatum::SerialWalker,tatum::FixedDelayCalculator>(args.analysis_type, *timing_graph, *timing_constraints, *delay_calculator);
+    serial_analyzer->set_clock_network_caching(args.cache_clock_network);
+    serial_analyzer->set_dominated_tag_pruning(args.prune_dominated_tags);
+    serial_analyzer->set_slack_threshold(tatum::Time(args.slack_threshold));
+    serial_analyzer->set_common_clock_index(common_clock_index);
+
+    //Pruned (or slack bounded) analyzers drop tags (so can't be verified against the golden 
+    //reference), instead their slacks are verified against an un-pruned analyzer
+    std::shared_ptr<tatum::TimingAnalyzer> unpruned_ref_analyzer;
+    if (args.prune_dominated_tags || !std::isnan(args.slack_threshold)) {
+        unpruned_ref_analyzer = make_analyzer(args.analysis_type, *timing_graph, *timing_constraints, *delay_calculator);
+        unpruned_ref_analyzer->set_common_clock_index(common_clock_index);
     }
+
     auto serial_setup_analyzer = std::dynamic_pointer_cast<tatum::SetupTimingAnalyzer>(serial_analyzer);
     auto serial_hold_analyzer = std::dynamic_pointer_cast<tatum::HoldTimingAnalyzer>(serial_analyzer);
 
     //Performance variables
     float serial_verify_time = 0.;
-    size_t serial_tags_verified = 0;
+    size_t serial_tags_verified = 0; //Against the golden reference (or un-pruned analyzer)
+    size_t serial_extra_tags_verified = 0; //Against the corner, derate and CPPR reference analyzers
     std::map<std::string,std::vector<double>> serial_prof_data;
     {
         cout << "Running Serial Analysis " << args.num_serial_runs << " times" << endl;
@@ -495,7 +650,17 @@ int main(int argc, char** argv) {
         clock_gettime(CLOCK_MONOTONIC, &verify_start);
 
         if (args.verify) {
-            auto res = verify_analyzer(*timing_graph, serial_analyzer, *golden_reference);
+            std::pair<size_t,bool> res;
+            if (unpruned_ref_analyzer) {
+                unpruned_ref_analyzer->update_timing();
+                if (args.prune_dominated_tags) {
+                    res = verify_endpoint_worst_slacks(*timing_graph, unpruned_ref_analyzer, serial_analyzer);
+                } else {
+                    res = verify_slack_bounds(*timing_graph, args.slack_threshold, unpruned_ref_analyzer, serial_analyzer);
+                }
+            } else {
+                res = verify_analyzer(*timing_graph, serial_analyzer, *golden_reference);
+            }
 
             serial_tags_verified = res.first;
 
@@ -503,6 +668,81 @@ int main(int argc, char** argv) {
                 cout << "Verification failed!\n";
                 exit_code = 1;
             }
+
+            if (args.corner_delay_scale != 0. && !unpruned_ref_analyzer) {
+                //Verify the other corners against an analysis of only that corner's delays
+                for (size_t corner = 1; corner < tatum::Time::num_corners(); ++corner) {
+                    tatum::FixedDelayCalculator corner_delay_calc = corner_delay_calculator(*timing_graph, *delay_calculator, corner);
+                    std::shared_ptr<tatum::TimingAnalyzer> corner_ref_analyzer = make_analyzer(args.analysis_type, *timing_graph, *timing_constraints, corner_delay_calc);
+                    corner_ref_analyzer->set_common_clock_pessimism_removal(args.cppr);
+                    corner_ref_analyzer->update_timing();
+
+                    res = verify_corner(*timing_graph, corner, corner_ref_analyzer, serial_analyzer);
+                    serial_extra_tags_verified += res.first;
+
+                    if(!res.second) {
+                        cout << "Corner " << corner << " verification failed!\n";
+                        exit_code = 1;
+                    }
+                }
+            }
+
+            if (args.derate != 0. && !unpruned_ref_analyzer) {
+                //Derating every delay by the same factor is equivalent to scaling the delays
+                tatum::TimingDerate derate;
+                for (tatum::DeratePath path : {tatum::DeratePath::CLOCK, tatum::DeratePath::DATA}) {
+                    for (tatum::ArrivalType arrival : {tatum::ArrivalType::EARLY, tatum::ArrivalType::LATE}) {
+                        derate.set_derate(path, arrival, args.derate);
+                    }
+                }
+
+                tatum::FixedDelayCalculator derated_delay_calc = derated_delay_calculator(*timing_graph, *delay_calculator, args.derate);
+                std::shared_ptr<tatum::TimingAnalyzer> derate_analyzer = make_analyzer(args.analysis_type, *timing_graph, *timing_constraints, *delay_calculator);
+                std::shared_ptr<tatum::TimingAnalyzer> derate_ref_analyzer = make_analyzer(args.analysis_type, *timing_graph, *timing_constraints, derated_delay_calc);
+                derate_analyzer->set_timing_derate(derate);
+                derate_analyzer->update_timing();
+                derate_ref_analyzer->update_timing();
+
+                res = verify_equivalent_analysis(*timing_graph, derated_delay_calc, derate_ref_analyzer, derate_analyzer);
+                serial_extra_tags_verified += res.first;
+
+                if(!res.second) {
+                    cout << "Derated verification failed!\n";
+                    exit_code = 1;
+                }
+
+                if (args.cppr && args.derate != 1.) {
+                    //Derating the clock network late and early in opposite directions adds pessimism
+                    //to the clock paths, which is partially removed by CPPR: the CPPR slacks should 
+                    //lie between those with the derate (but no CPPR) and those without the derate
+                    //(with CPPR, which may still remove source latency pessimism)
+                    float late_factor = std::max(args.derate, 1.f / args.derate);
+                    tatum::TimingDerate clock_derate;
+                    clock_derate.set_derate(tatum::DeratePath::CLOCK, tatum::ArrivalType::LATE, late_factor);
+                    clock_derate.set_derate(tatum::DeratePath::CLOCK, tatum::ArrivalType::EARLY, 1.f / late_factor);
+
+                    std::shared_ptr<tatum::TimingAnalyzer> underated_analyzer = make_analyzer(args.analysis_type, *timing_graph, *timing_constraints, *delay_calculator);
+                    std::shared_ptr<tatum::TimingAnalyzer> pessimistic_analyzer = make_analyzer(args.analysis_type, *timing_graph, *timing_constraints, *delay_calculator);
+                    std::shared_ptr<tatum::TimingAnalyzer> cppr_analyzer = make_analyzer(args.analysis_type, *timing_graph, *timing_constraints, *delay_calculator);
+
+                    pessimistic_analyzer->set_timing_derate(clock_derate);
+                    underated_analyzer->set_common_clock_index(common_clock_index);
+                    cppr_analyzer->set_timing_derate(clock_derate);
+                    cppr_analyzer->set_common_clock_index(common_clock_index);
+
+                    underated_analyzer->update_timing();
+                    pessimistic_analyzer->update_timing();
+                    cppr_analyzer->update_timing();
+
+                    res = verify_endpoint_slacks_between(*timing_graph, pessimistic_analyzer, underated_analyzer, cppr_analyzer);
+                    serial_extra_tags_verified += res.first;
+
+                    if(!res.second) {
+                        cout << "CPPR verification failed!\n";
+                        exit_code = 1;
+                    }
+                }
+            }
         }
 
         clock_gettime(CLOCK_MONOTONIC, &verify_end);
@@ -538,12 +778,18 @@ int main(int argc, char** argv) {
         cout << " (" << std::setprecision(2) << median(serial_prof_data["update_slack_sec"])/median(serial_prof_data["analysis_sec"]) << ")" << endl;
 
         cout << "Verifying Serial Analysis took: " << serial_verify_time << " sec" << endl;
-        if(serial_tags_verified == golden_reference->num_tags() || serial_tags_verified == golden_reference->num_tags() / 2) {
+        if (unpruned_ref_analyzer) {
+            //Pruned analyzers keep fewer tags than the golden reference
+            cout << "\tVerified " << serial_tags_verified << " tags against the un-pruned analysis accross " << timing_graph->nodes().size() << " nodes" << endl;
+        } else if(serial_tags_verified == golden_reference->num_tags() || serial_tags_verified == golden_reference->num_tags() / 2) {
             //Potentially allow / 2 for setup only analysis from setup/hold golden
             cout << "\tVerified " << serial_tags_verified << " tags (expected " << golden_reference->num_tags() << " or " << golden_reference->num_tags()/2 << ") accross " << timing_graph->nodes().size() << " nodes" << endl;
         } else {
             cout << "WARNING: Expected tags (" << golden_reference->num_tags() << ") differs from tags checked (" << serial_tags_verified << ") , verification may not have occured!" << endl;
         }
+        if (serial_extra_tags_verified > 0) {
+            cout << "\tVerified " << serial_extra_tags_verified << " additional tags against corner, derate and CPPR reference analyses" << endl;
+        }
         cout << endl;
         cout << endl << "Net Serial Analysis elapsed time: " << serial_analyzer->get_profiling_data("total_analysis_sec") << " sec over " << serial_analyzer->get_profiling_data("num_full_updates") << " full updates" << endl;
     }
@@ -557,18 +803,30 @@ int main(int argc, char** argv) {
 
     if (args.num_serial_incr_runs) {
 
-        std::shared_ptr<tatum::TimingAnalyzer> serial_incr_analyzer;
-        if (args.analysis_type == "setuphold") {
-            serial_incr_analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis,tatum::SerialIncrWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
-        } else if (args.analysis_type == "setup") {
-            serial_incr_analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis,tatum::SerialIncrWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
-        } else if (args.analysis_type == "hold") {
-            serial_incr_analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis,tatum::SerialIncrWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
+        std::unique_ptr<tatum::CachingDelayCalculator> incr_delay_cache;
+        const tatum::DelayCalculator* incr_delay_calculator = delay_calculator.get();
+        if (args.incr_cache_delays) {
+            incr_delay_cache = std::make_unique<tatum::CachingDelayCalculator>(*timing_graph, *delay_calculator);
+            incr_delay_calculator = incr_delay_cache.get();
+        }
+
+        std::shared_ptr<tatum::TimingAnalyzer> serial_incr_analyzer = make_analyzer<tatum::SerialIncrWalker>(args.analysis_type, *timing_graph, *timing_constraints, *incr_delay_calculator);
+
+        if (args.incr_invalidation_policy == "edge") {
+            serial_incr_analyzer->set_incr_invalidation_policy(tatum::IncrInvalidationPolicy::EDGE);
+        } else if (args.incr_invalidation_policy == "block") {
+            serial_incr_analyzer->set_incr_invalidation_policy(tatum::IncrInvalidationPolicy::BLOCK);
+        } else if (args.incr_invalidation_policy == "adaptive") {
+            serial_incr_analyzer->set_incr_invalidation_policy(tatum::IncrInvalidationPolicy::ADAPTIVE);
         } else {
             std::stringstream ss;
-            ss << "Unrecognized analysis type '" << args.analysis_type << "'";
+            ss << "Unrecognized incremental invalidation policy '" << args.incr_invalidation_policy << "'";
             cmd_error(argv[0], ss.str());
         }
+
+        serial_incr_analyzer->set_dominated_tag_pruning(args.prune_dominated_tags);
+        serial_incr_analyzer->set_common_clock_index(common_clock_index);
+
         auto serial_incr_setup_analyzer = std::dynamic_pointer_cast<tatum::SetupTimingAnalyzer>(serial_incr_analyzer);
         auto serial_incr_hold_analyzer = std::dynamic_pointer_cast<tatum::HoldTimingAnalyzer>(serial_incr_analyzer);
 
@@ -580,11 +838,16 @@ int main(int argc, char** argv) {
             //Analyze
             bool equivalent = profile_incr(args.num_serial_incr_runs,
                                            args.edge_change_prob,
+                                           args.incr_endpoint_first,
+                                           args.incr_track_delay_changes,
                                            args.verify,
+                                           args.prune_dominated_tags, //Verify endpoints only
                                            *timing_graph,
+                                           *timing_constraints,
                                            serial_incr_analyzer,
-                                           serial_analyzer,
+                                           unpruned_ref_analyzer ? unpruned_ref_analyzer : serial_analyzer,
                                            *delay_calculator,
+                                           incr_delay_cache.get(),
                                            serial_incr_prof_data);
 
             if(!equivalent) {
@@ -613,6 +876,9 @@ int main(int argc, char** argv) {
             cout << "\tReq Pre-traversal Median: " << std::setprecision(6) << std::setw(6) << median_skip_first(serial_incr_prof_data["required_pre_traversal_sec"]) << " s";
             cout << " (" << std::setprecision(2) << median_skip_first(serial_incr_prof_data["required_pre_traversal_sec"])/median_skip_first(serial_incr_prof_data["analysis_sec"]) << ")" << endl;
 
+            cout << "\tIncr prepare      Median: " << std::setprecision(6) << std::setw(6) << median_skip_first(serial_incr_prof_data["incr_prepare_sec"]) << " s";
+            cout << " (" << std::setprecision(2) << median_skip_first(serial_incr_prof_data["incr_prepare_sec"])/median_skip_first(serial_incr_prof_data["analysis_sec"]) << ")" << endl;
+
             cout << "\tArr     traversal Median: " << std::setprecision(6) << std::setw(6) << median_skip_first(serial_incr_prof_data["arrival_traversal_sec"]) << " s";
             cout << " (" << std::setprecision(2) << median_skip_first(serial_incr_prof_data["arrival_traversal_sec"])/median_skip_first(serial_incr_prof_data["analysis_sec"]) << ")" << endl;
 
@@ -622,6 +888,18 @@ int main(int argc, char** argv) {
             cout << "\tUpdate slack      Median: " << std::setprecision(6) << std::setw(6) << median_skip_first(serial_incr_prof_data["update_slack_sec"]) << " s";
             cout << " (" << std::setprecision(2) << median_skip_first(serial_incr_prof_data["update_slack_sec"])/median_skip_first(serial_incr_prof_data["analysis_sec"]) << ")" << endl;
 
+            cout << "\tSlack summary     Median: " << std::setprecision(6) << std::setw(6) << median_skip_first(serial_incr_prof_data["slack_summary_sec"]) << " s" << endl;
+
+            cout << "\tInvalidated edges Median: " << std::setprecision(6) << median_skip_first(serial_incr_prof_data["num_invalidated_edges"]) << endl;
+            cout << "\tArr nodes touched Median: " << median_skip_first(serial_incr_prof_data["num_arrival_nodes_processed"]) << endl;
+            cout << "\tReq nodes touched Median: " << median_skip_first(serial_incr_prof_data["num_required_nodes_processed"]) << endl;
+            cout << "\tNodes modified    Median: " << median_skip_first(serial_incr_prof_data["num_modified_nodes"]) << endl;
+            cout << "\tBlock invalidations    : " << std::accumulate(serial_incr_prof_data["incr_block_invalidation"].begin(), serial_incr_prof_data["incr_block_invalidation"].end(), 0.) << endl;
+            cout << "\tFull fallbacks         : " << std::accumulate(serial_incr_prof_data["incr_fallback_to_full"].begin(), serial_incr_prof_data["incr_fallback_to_full"].end(), 0.) << endl;
+            if (args.incr_endpoint_first) {
+                cout << "\tEndpoint-only updates  : " << serial_incr_analyzer->get_profiling_data("num_endpoint_updates") << endl;
+            }
+
             cout << "Verifying SerialIncr Analysis took: " <<  serial_incr_verify_time<< " sec" << endl;
         }
         cout << endl;
@@ -636,22 +914,16 @@ int main(int argc, char** argv) {
         cout << "\t     Update-slack: " << std::fixed << median(serial_incr_prof_data["ref_update_slack_sec"]) / median(serial_incr_prof_data["update_slack_sec"]) << "x" << endl;
         cout << endl;
 
-        cout << endl << "Net SerialIncr Analysis elapsed time: " << serial_incr_analyzer->get_profiling_data("total_analysis_sec") << " sec over " << serial_incr_analyzer->get_profiling_data("num_full_updates") << " full updates" << endl;
+        cout << endl << "Net SerialIncr Analysis elapsed time: " << serial_incr_analyzer->get_profiling_data("total_analysis_sec") << " sec over " << serial_incr_analyzer->get_profiling_data("num_full_updates") << " full updates and " << serial_incr_analyzer->get_profiling_data("num_incr_updates") << " incremental updates" << endl;
     }
 
     if (args.num_parallel_runs) {
-        std::shared_ptr<tatum::TimingAnalyzer> parallel_analyzer;
-        if (args.analysis_type == "setuphold") {
-            parallel_analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis,tatum::ParallelWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
-        } else if (args.analysis_type == "setup") {
-            parallel_analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis,tatum::ParallelWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
-        } else if (args.analysis_type == "hold") {
-            parallel_analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis,tatum::ParallelWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
-        } else {
-            std::stringstream ss;
-            ss << "Unrecognized analysis type '" << args.analysis_type << "'";
-            cmd_error(argv[0], ss.str());
-        }
+        std::shared_ptr<tatum::TimingAnalyzer> parallel_analyzer = make_analyzer<tatum::ParallelWalker,tatum::FixedDelayCalculator>(args.analysis_type, *timing_graph, *timing_constraints, *delay_calculator);
+
+        parallel_analyzer->set_clock_network_caching(args.cache_clock_network);
+        parallel_analyzer->set_dominated_tag_pruning(args.prune_dominated_tags);
+        parallel_analyzer->set_slack_threshold(tatum::Time(args.slack_threshold));
+        parallel_analyzer->set_common_clock_index(common_clock_index);
 
         auto parallel_setup_analyzer = std::dynamic_pointer_cast<tatum::SetupTimingAnalyzer>(parallel_analyzer);
         auto parallel_hold_analyzer = std::dynamic_pointer_cast<tatum::HoldTimingAnalyzer>(parallel_analyzer);
@@ -670,7 +942,17 @@ int main(int argc, char** argv) {
 
             if (args.verify) {
                 cout << "\n";
-                auto res = verify_analyzer(*timing_graph, parallel_analyzer, *golden_reference);
+                std::pair<size_t,bool> res;
+                if (unpruned_ref_analyzer) {
+                    unpruned_ref_analyzer->update_timing();
+                    if (args.prune_dominated_tags) {
+                        res = verify_endpoint_worst_slacks(*timing_graph, unpruned_ref_analyzer, parallel_analyzer);
+                    } else {
+                        res = verify_slack_bounds(*timing_graph, args.slack_threshold, unpruned_ref_analyzer, parallel_analyzer);
+                    }
+                } else {
+                    res = verify_analyzer(*timing_graph, parallel_analyzer, *golden_reference);
+                }
 
                 parallel_tags_verified = res.first;
 
@@ -712,9 +994,12 @@ int main(int argc, char** argv) {
             cout << " (" << std::setprecision(2) << median(parallel_prof_data["update_slack_sec"])/median(parallel_prof_data["analysis_sec"]) << ")" << endl;
 
             cout << "Verifying Parallel Analysis took: " <<  parallel_verify_time<< " sec" << endl;
-            if(parallel_tags_verified == golden_reference->num_tags() || parallel_tags_verified == golden_reference->num_tags()/2) {
+            if (unpruned_ref_analyzer) {
+                //Pruned analyzers keep fewer tags than the golden reference
+                cout << "\tVerified " << parallel_tags_verified << " tags against the un-pruned analysis accross " << timing_graph->nodes().size() << " nodes" << endl;
+            } else if(parallel_tags_verified == golden_reference->num_tags() || parallel_tags_verified == golden_reference->num_tags()/2) {
                 //Potentially allow / 2 for setup only analysis from setup/hold golden
-                cout << "\tVerified " << serial_tags_verified << " tags (expected " << golden_reference->num_tags() << " or " << golden_reference->num_tags()/2 << ") accross " << timing_graph->nodes().size() << " nodes" << endl;
+                cout << "\tVerified " << parallel_tags_verified << " tags (expected " << golden_reference->num_tags() << " or " << golden_reference->num_tags()/2 << ") accross " << timing_graph->nodes().size() << " nodes" << endl;
             } else {
                 cout << "WARNING: Expected tags (" << golden_reference->num_tags() << ") differs from tags checked (" << parallel_tags_verified << ") , verification may not have occured!" << endl;
             }
@@ -8,7 +8,9 @@
 
 #include "tatum/TimingGraph.hpp"
 #include "tatum/analyzer_factory.hpp"
+#include "tatum/SlackSummary.hpp"
 #include "tatum/base/sta_util.hpp"
+#include "tatum/delay_calc/TrackingDelayCalculator.hpp"
 
 #ifdef TATUM_TEST_PROFILE_VTUNE
 #include "ittnotify.h"
@@ -71,11 +73,16 @@ std::map<std::string,std::vector<double>> profile(size_t num_iterations, std::sh
 
 bool profile_incr(size_t num_iterations,
                   float edge_change_prob,
+                  bool endpoint_first,
+                  bool track_delay_changes,
                   bool verify,
+                  bool verify_endpoints_only,
                   const tatum::TimingGraph& tg,
+                  const tatum::TimingConstraints& tc,
                   std::shared_ptr<tatum::TimingAnalyzer> check_analyzer,
                   std::shared_ptr<tatum::TimingAnalyzer> ref_analyzer,
                   tatum::FixedDelayCalculator& delay_calc,
+                  tatum::CachingDelayCalculator* delay_cache,
                   std::map<std::string,std::vector<double>>& prof_data) {
 
     std::minstd_rand rng;
@@ -94,6 +101,74 @@ bool profile_incr(size_t num_iterations,
         }
     }
 
+    //Randomly changes the delays of num_edges edges, returning the changed edges
+    auto change_edge_delays = [&](size_t num_edges) {
+        std::vector<tatum::EdgeId> changed_edges;
+        changed_edges.reserve(num_edges);
+        for (size_t j = 0; j < num_edges; j++) {
+            size_t iedge = uniform_distr(rng);
+            tatum::EdgeId edge(iedge);
+
+            changed_edges.push_back(edge);
+
+            //Set new delays
+            //std::cout << "New Delay: " << edge;
+            if (tg.edge_type(edge) == tatum::EdgeType::PRIMITIVE_CLOCK_CAPTURE) {
+                float new_setup = std::max<float>(0, delay_calc.setup_time(tg, edge).value() + normal_distr(rng));
+                float new_hold = std::max<float>(0, delay_calc.hold_time(tg, edge).value() + normal_distr(rng));
+                //std::cout << " setup: " << new_setup << " hold: " << new_hold;
+                delay_calc.set_setup_time(tg, edge, tatum::Time(new_setup));
+                delay_calc.set_hold_time(tg, edge, tatum::Time(new_hold));
+            } else {
+                float new_max = std::max<float>(0, delay_calc.max_edge_delay(tg, edge).value() + normal_distr(rng));
+                float new_min = std::max<float>(0, delay_calc.min_edge_delay(tg, edge).value() + normal_distr(rng));
+                //std::cout << " min: " << new_min << " max: " << new_max << " (was: " << delay_calc.min_edge_delay(tg, edge).value() << ", " << delay_calc.max_edge_delay(tg, edge).value() << ")";
+                delay_calc.set_max_edge_delay(tg, edge, tatum::Time(new_max));
+                delay_calc.set_min_edge_delay(tg, edge, tatum::Time(new_min));
+            }
+            //std::cout << "\n";
+        }
+        return changed_edges;
+    };
+
+    //Optionally let the analyzer under test invalidate only the edges whose delays actually
+    //changed (rather than every edge modified), recording the initial delays
+    std::unique_ptr<tatum::TrackingDelayCalculator> delay_tracker;
+    if (track_delay_changes) {
+        delay_tracker = std::make_unique<tatum::TrackingDelayCalculator>(tg, delay_calc);
+        delay_tracker->find_changed_edges();
+    }
+
+    auto invalidate_check_edges = [&](const std::vector<tatum::EdgeId>& modified_edges) {
+        if (delay_cache) {
+            delay_cache->invalidate_edges(modified_edges);
+        }
+
+        if (delay_tracker) {
+            delay_tracker->find_changed_edges();
+            delay_tracker->invalidate_changed_edges(*check_analyzer);
+        } else {
+            check_analyzer->invalidate_edges(modified_edges);
+        }
+    };
+
+    //Incrementally maintained slack summaries of the analyzer under test
+    std::vector<tatum::SlackSummary> slack_summaries;
+    if (auto setup_check_analyzer = std::dynamic_pointer_cast<tatum::SetupTimingAnalyzer>(check_analyzer)) {
+        slack_summaries.emplace_back(tg, tc, *setup_check_analyzer);
+    }
+    if (auto hold_check_analyzer = std::dynamic_pointer_cast<tatum::HoldTimingAnalyzer>(check_analyzer)) {
+        slack_summaries.emplace_back(tg, tc, *hold_check_analyzer);
+    }
+
+    auto update_slack_summaries = [&]() {
+        auto start = Clock::now();
+        for (tatum::SlackSummary& summary : slack_summaries) {
+            summary.update();
+        }
+        return std::chrono::duration_cast<dsec>(Clock::now() - start).count();
+    };
+
     struct timespec verify_start;
     struct timespec verify_end;
 
@@ -106,33 +181,27 @@ bool profile_incr(size_t num_iterations,
 
         if (i > 0) {
             //Randomly invalidate edges
-
             size_t EDGES_TO_INVALIDATE = edge_change_prob * tg.edges().size();
-            for (size_t j = 0; j < EDGES_TO_INVALIDATE; j++) {
-                size_t iedge = uniform_distr(rng);
-                tatum::EdgeId edge(iedge);
-
-                //Invalidate
-                check_analyzer->invalidate_edge(edge);
-                ref_analyzer->invalidate_edge(edge);
-
-                //Set new delays
-                //std::cout << "New Delay: " << edge;
-                if (tg.edge_type(edge) == tatum::EdgeType::PRIMITIVE_CLOCK_CAPTURE) {
-                    float new_setup = std::max<float>(0, delay_calc.setup_time(tg, edge).value() + normal_distr(rng));
-                    float new_hold = std::max<float>(0, delay_calc.hold_time(tg, edge).value() + normal_distr(rng));
-                    //std::cout << " setup: " << new_setup << " hold: " << new_hold;
-                    delay_calc.set_setup_time(tg, edge, tatum::Time(new_setup));
-                    delay_calc.set_hold_time(tg, edge, tatum::Time(new_hold));
-                } else {
-                    float new_max = std::max<float>(0, delay_calc.max_edge_delay(tg, edge).value() + normal_distr(rng));
-                    float new_min = std::max<float>(0, delay_calc.min_edge_delay(tg, edge).value() + normal_distr(rng));
-                    //std::cout << " min: " << new_min << " max: " << new_max << " (was: " << delay_calc.min_edge_delay(tg, edge).value() << ", " << delay_calc.max_edge_delay(tg, edge).value() << ")";
-                    delay_calc.set_max_edge_delay(tg, edge, tatum::Time(new_max));
-                    delay_calc.set_min_edge_delay(tg, edge, tatum::Time(new_min));
-                }
-                //std::cout << "\n";
+
+            if (endpoint_first) {
+                //Change half the edges and update only the endpoints (deferring the
+                //rest of the update), then change the remainder before the full update
+                std::vector<tatum::EdgeId> invalidated_edges = change_edge_delays(EDGES_TO_INVALIDATE / 2);
+                invalidate_check_edges(invalidated_edges);
+                ref_analyzer->invalidate_edges(invalidated_edges);
+
+                if (delay_cache) delay_cache->update();
+                check_analyzer->update_endpoint_timing();
+                update_slack_summaries();
+
+                EDGES_TO_INVALIDATE -= EDGES_TO_INVALIDATE / 2;
             }
+
+            std::vector<tatum::EdgeId> invalidated_edges = change_edge_delays(EDGES_TO_INVALIDATE);
+
+            //Invalidate
+            invalidate_check_edges(invalidated_edges);
+            ref_analyzer->invalidate_edges(invalidated_edges);
         }
 
         //Analyze
@@ -141,6 +210,7 @@ bool profile_incr(size_t num_iterations,
         std::cout << "Toggle Collect (Start)\n";
         CALLGRIND_TOGGLE_COLLECT;
 #endif
+        if (delay_cache) delay_cache->update();
         check_analyzer->update_timing();
 
 #ifdef TATUM_TEST_PROFILE_CALLGRIND
@@ -151,13 +221,20 @@ bool profile_incr(size_t num_iterations,
         std::cout << "Callgrind Dump Stats " << ss.str() << "\n";
         CALLGRIND_DUMP_STATS_AT(ss.str().c_str());
 #endif
+        double slack_summary_sec = update_slack_summaries();
+
         ref_analyzer->update_timing();
 
         //Verify
         clock_gettime(CLOCK_MONOTONIC, &verify_start);
 
         if (verify) {
-            auto res = verify_equivalent_analysis(tg, delay_calc, ref_analyzer, check_analyzer);
+            std::pair<size_t,bool> res;
+            if (verify_endpoints_only) {
+                res = verify_endpoint_worst_slacks(tg, ref_analyzer, check_analyzer);
+            } else {
+                res = verify_equivalent_analysis(tg, delay_calc, ref_analyzer, check_analyzer);
+            }
 
             if (res.second) {
                 std::cout << "Equivalent\n";
@@ -166,6 +243,13 @@ bool profile_incr(size_t num_iterations,
                 return false;
             }
 
+            for (const tatum::SlackSummary& summary : slack_summaries) {
+                if (!verify_slack_summary(tg, tc, summary, ref_analyzer, !verify_endpoints_only)) {
+                    std::cout << "Slack summary not equivalent\n";
+                    return false;
+                }
+            }
+
         }
         clock_gettime(CLOCK_MONOTONIC, &verify_end);
 
@@ -175,6 +259,11 @@ bool profile_incr(size_t num_iterations,
             prof_data[key].push_back(check_analyzer->get_profiling_data(key));
             prof_data[std::string("ref_") + key].push_back(ref_analyzer->get_profiling_data(key));
         }
+        //Incremental book-keeping (only reported by the incremental analyzer)
+        for(auto key : {"incr_prepare_sec", "num_invalidated_edges", "num_arrival_nodes_processed", "num_required_nodes_processed", "num_modified_nodes", "incr_fallback_to_full", "incr_estimated_dirty_nodes", "incr_fallback_threshold_nodes", "incr_block_invalidation"}) {
+            prof_data[key].push_back(check_analyzer->get_profiling_data(key));
+        }
+        prof_data["slack_summary_sec"].push_back(slack_summary_sec);
         prof_data["verify_sec"].push_back(tatum::time_sec(verify_start, verify_end));
 
         std::cout << ".";
@@ -6,17 +6,24 @@
 #include <memory>
 
 #include "tatum/timing_analyzers.hpp"
+#include "tatum/TimingConstraintsFwd.hpp"
 #include "tatum/delay_calc/FixedDelayCalculator.hpp"
+#include "tatum/delay_calc/CachingDelayCalculator.hpp"
 
 std::map<std::string,std::vector<double>> profile(size_t num_iterations, std::shared_ptr<tatum::TimingAnalyzer> serial_analyzer);
 
 bool profile_incr(size_t num_iterations,
                   float edge_change_prob,
+                  bool endpoint_first,
+                  bool track_delay_changes,
                   bool verify,
+                  bool verify_endpoints_only,
                   const tatum::TimingGraph& tg,
+                  const tatum::TimingConstraints& tc,
                   std::shared_ptr<tatum::TimingAnalyzer> check_analyzer,
                   std::shared_ptr<tatum::TimingAnalyzer> ref_analyzer,
                   tatum::FixedDelayCalculator& delay_calc,
+                  tatum::CachingDelayCalculator* delay_cache,
                   std::map<std::string,std::vector<double>>& prof_data);
 
 #endif
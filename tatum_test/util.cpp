@@ -17,25 +17,50 @@ float relative_error(float A, float B) {
     }
 }
 
-void remap_delay_calculator(const tatum::TimingGraph& tg, tatum::FixedDelayCalculator& dc, const tatum::util::linear_map<EdgeId,EdgeId>& edge_id_map) {
+static Time scale_corners(Time delay, float scale) {
+    for (size_t corner = 1; corner < Time::num_corners(); ++corner) {
+        delay.set_value(corner, delay.value(corner) * (1. + corner * scale));
+    }
+    return delay;
+}
+
+void scale_corner_delays(const tatum::TimingGraph& tg, tatum::FixedDelayCalculator& dc, float scale) {
+    for (EdgeId edge : tg.edges()) {
+        dc.set_max_edge_delay(tg, edge, scale_corners(dc.max_edge_delay(tg, edge), scale));
+        dc.set_setup_time(tg, edge, scale_corners(dc.setup_time(tg, edge), scale));
+        dc.set_min_edge_delay(tg, edge, scale_corners(dc.min_edge_delay(tg, edge), scale));
+        dc.set_hold_time(tg, edge, scale_corners(dc.hold_time(tg, edge), scale));
+    }
+}
+
+tatum::FixedDelayCalculator corner_delay_calculator(const tatum::TimingGraph& tg, const tatum::FixedDelayCalculator& dc, size_t corner) {
+    tatum::util::linear_map<EdgeId,Time> max_edge_delays(tg.edges().size());
+    tatum::util::linear_map<EdgeId,Time> setup_times(tg.edges().size());
+    tatum::util::linear_map<EdgeId,Time> min_edge_delays(tg.edges().size());
+    tatum::util::linear_map<EdgeId,Time> hold_times(tg.edges().size());
 
-    tatum::util::linear_map<EdgeId,Time> max_edge_delays(edge_id_map.size());
-    tatum::util::linear_map<EdgeId,Time> setup_times(edge_id_map.size());
-    tatum::util::linear_map<EdgeId,Time> min_edge_delays(edge_id_map.size());
-    tatum::util::linear_map<EdgeId,Time> hold_times(edge_id_map.size());
+    for (EdgeId edge : tg.edges()) {
+        max_edge_delays[edge] = Time(dc.max_edge_delay(tg, edge).value(corner));
+        setup_times[edge] = Time(dc.setup_time(tg, edge).value(corner));
+        min_edge_delays[edge] = Time(dc.min_edge_delay(tg, edge).value(corner));
+        hold_times[edge] = Time(dc.hold_time(tg, edge).value(corner));
+    }
 
-    //Re-map
-    for(size_t iedge = 0; iedge < edge_id_map.size(); ++iedge) {
-        EdgeId old_edge(iedge);
-        EdgeId new_edge = edge_id_map[old_edge];
+    return tatum::FixedDelayCalculator(max_edge_delays, setup_times, min_edge_delays, hold_times);
+}
 
-        max_edge_delays[new_edge] = dc.max_edge_delay(tg, old_edge);
-        setup_times[new_edge] = dc.setup_time(tg, old_edge);
-        min_edge_delays[new_edge] = dc.min_edge_delay(tg, old_edge);
-        hold_times[new_edge] = dc.hold_time(tg, old_edge);
+tatum::FixedDelayCalculator derated_delay_calculator(const tatum::TimingGraph& tg, const tatum::FixedDelayCalculator& dc, float factor) {
+    tatum::util::linear_map<EdgeId,Time> max_edge_delays(tg.edges().size());
+    tatum::util::linear_map<EdgeId,Time> setup_times(tg.edges().size());
+    tatum::util::linear_map<EdgeId,Time> min_edge_delays(tg.edges().size());
+    tatum::util::linear_map<EdgeId,Time> hold_times(tg.edges().size());
 
+    for (EdgeId edge : tg.edges()) {
+        max_edge_delays[edge] = dc.max_edge_delay(tg, edge) * factor;
+        setup_times[edge] = dc.setup_time(tg, edge);
+        min_edge_delays[edge] = dc.min_edge_delay(tg, edge) * factor;
+        hold_times[edge] = dc.hold_time(tg, edge);
     }
 
-    //Update
-    dc = tatum::FixedDelayCalculator(max_edge_delays, setup_times, min_edge_delays, hold_times);
+    return tatum::FixedDelayCalculator(max_edge_delays, setup_times, min_edge_delays, hold_times);
 }
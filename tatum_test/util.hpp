@@ -8,4 +8,11 @@
 
 float relative_error(float A, float B);
 
-void remap_delay_calculator(const tatum::TimingGraph& tg, tatum::FixedDelayCalculator& dc, const tatum::util::linear_map<tatum::EdgeId,tatum::EdgeId>& edge_id_map);
+//Scales the delays of each timing corner (see tatum::Time) by (1 + corner*scale)
+void scale_corner_delays(const tatum::TimingGraph& tg, tatum::FixedDelayCalculator& dc, float scale);
+
+//Returns a delay calculator with the delays of the specified corner in every corner
+tatum::FixedDelayCalculator corner_delay_calculator(const tatum::TimingGraph& tg, const tatum::FixedDelayCalculator& dc, size_t corner);
+
+//Returns a delay calculator with the edge delays (but not setup/hold times) scaled by factor
+tatum::FixedDelayCalculator derated_delay_calculator(const tatum::TimingGraph& tg, const tatum::FixedDelayCalculator& dc, float factor);
@@ -1,10 +1,15 @@
 #include <iostream>
 #include <memory>
+#include <algorithm>
+#include <map>
+#include <limits>
+#include <cmath>
 
 #include "verify.hpp"
 #include "tatum/tags/TimingTags.hpp"
 #include "tatum/tags/TimingTag.hpp"
 #include "tatum/timing_analyzers.hpp"
+#include "tatum/timing_paths.hpp"
 #include "tatum/report/graphviz_dot_writer.hpp"
 #include "util.hpp"
 
@@ -232,6 +237,293 @@ std::pair<size_t,bool> verify_equivalent_analysis(const TimingGraph& tg, const D
     return {tags_checked,!error};
 }
 
+//Returns the worst slack of the specified tags (NaN if there are none)
+static float worst_slack(TimingTags::tag_range slacks) {
+    if (slacks.empty()) return std::numeric_limits<float>::quiet_NaN();
+
+    return find_minimum_tag(slacks)->time().value();
+}
+
+std::pair<size_t,bool> verify_endpoint_worst_slacks(const TimingGraph& tg, std::shared_ptr<TimingAnalyzer> ref_analyzer,  std::shared_ptr<TimingAnalyzer> check_analyzer) {
+    //Compares only the worst slack of each endpoint, which is all that is preserved
+    //by analyzers which prune tags (see TimingAnalyzer::set_dominated_tag_pruning())
+    bool valid = true;
+    size_t endpoints_checked = 0;
+
+    auto setup_ref_analyzer = std::dynamic_pointer_cast<SetupTimingAnalyzer>(ref_analyzer);
+    auto hold_ref_analyzer = std::dynamic_pointer_cast<HoldTimingAnalyzer>(ref_analyzer);
+    auto setup_check_analyzer = std::dynamic_pointer_cast<SetupTimingAnalyzer>(check_analyzer);
+    auto hold_check_analyzer = std::dynamic_pointer_cast<HoldTimingAnalyzer>(check_analyzer);
+
+    for (NodeId node : tg.logical_outputs()) {
+        if (setup_ref_analyzer) {
+            TATUM_ASSERT(setup_check_analyzer);
+            valid &= verify_time(node, DomainId::INVALID(), DomainId::INVALID(), 
+                                 worst_slack(setup_check_analyzer->setup_slacks(node)), 
+                                 worst_slack(setup_ref_analyzer->setup_slacks(node)), 
+                                 "setup_endpoint_worst_slack");
+            ++endpoints_checked;
+        }
+
+        if (hold_ref_analyzer) {
+            TATUM_ASSERT(hold_check_analyzer);
+            valid &= verify_time(node, DomainId::INVALID(), DomainId::INVALID(), 
+                                 worst_slack(hold_check_analyzer->hold_slacks(node)), 
+                                 worst_slack(hold_ref_analyzer->hold_slacks(node)), 
+                                 "hold_endpoint_worst_slack");
+            ++endpoints_checked;
+        }
+    }
+
+    return {endpoints_checked, valid};
+}
+
+//Verifies that check_slack lies between lower_slack and upper_slack (within tolerance)
+static bool verify_slack_between(NodeId node, float check_slack, float lower_slack, float upper_slack, std::string type) {
+    if (std::isnan(check_slack) && std::isnan(lower_slack) && std::isnan(upper_slack)) return true; //No slack
+
+    float tolerance = std::max(ABSOLUTE_EPSILON, RELATIVE_EPSILON * std::max(std::fabs(lower_slack), std::fabs(upper_slack)));
+    if (!(check_slack >= lower_slack - tolerance && check_slack <= upper_slack + tolerance)) {
+        cout << "Node: " << node << " " << type;
+        cout << " Calc: " << check_slack;
+        cout << " Lower: " << lower_slack;
+        cout << " Upper: " << upper_slack << endl;
+        cout << "\tERROR slack is not within bounds" << endl;
+        return false;
+    }
+    return true;
+}
+
+std::pair<size_t,bool> verify_endpoint_slacks_between(const TimingGraph& tg, std::shared_ptr<TimingAnalyzer> lower_analyzer, std::shared_ptr<TimingAnalyzer> upper_analyzer, std::shared_ptr<TimingAnalyzer> check_analyzer) {
+    //Compares the worst slack of each endpoint against the bounds calculated by 
+    //two other analyzers (e.g. with and without pessimism)
+    bool valid = true;
+    size_t endpoints_checked = 0;
+
+    auto setup_lower_analyzer = std::dynamic_pointer_cast<SetupTimingAnalyzer>(lower_analyzer);
+    auto hold_lower_analyzer = std::dynamic_pointer_cast<HoldTimingAnalyzer>(lower_analyzer);
+    auto setup_upper_analyzer = std::dynamic_pointer_cast<SetupTimingAnalyzer>(upper_analyzer);
+    auto hold_upper_analyzer = std::dynamic_pointer_cast<HoldTimingAnalyzer>(upper_analyzer);
+    auto setup_check_analyzer = std::dynamic_pointer_cast<SetupTimingAnalyzer>(check_analyzer);
+    auto hold_check_analyzer = std::dynamic_pointer_cast<HoldTimingAnalyzer>(check_analyzer);
+
+    for (NodeId node : tg.logical_outputs()) {
+        if (setup_check_analyzer) {
+            TATUM_ASSERT(setup_lower_analyzer && setup_upper_analyzer);
+            valid &= verify_slack_between(node,
+                                          worst_slack(setup_check_analyzer->setup_slacks(node)), 
+                                          worst_slack(setup_lower_analyzer->setup_slacks(node)), 
+                                          worst_slack(setup_upper_analyzer->setup_slacks(node)), 
+                                          "setup_endpoint_worst_slack");
+            ++endpoints_checked;
+        }
+
+        if (hold_check_analyzer) {
+            TATUM_ASSERT(hold_lower_analyzer && hold_upper_analyzer);
+            valid &= verify_slack_between(node,
+                                          worst_slack(hold_check_analyzer->hold_slacks(node)), 
+                                          worst_slack(hold_lower_analyzer->hold_slacks(node)), 
+                                          worst_slack(hold_upper_analyzer->hold_slacks(node)), 
+                                          "hold_endpoint_worst_slack");
+            ++endpoints_checked;
+        }
+    }
+
+    return {endpoints_checked, valid};
+}
+
+//Verifies that slack is exact if within the threshold, and otherwise a lower bound above the threshold
+static bool verify_slack_bound(NodeId node, float check_slack, float ref_slack, float slack_threshold, std::string type) {
+    if (std::isnan(ref_slack) || ref_slack <= slack_threshold) {
+        return verify_time(node, DomainId::INVALID(), DomainId::INVALID(), check_slack, ref_slack, type);
+    }
+
+    if (!(check_slack > slack_threshold && check_slack <= ref_slack + ABSOLUTE_EPSILON)) {
+        cout << "Node: " << node << " " << type;
+        cout << " Calc: " << check_slack;
+        cout << " Ref: " << ref_slack << endl;
+        cout << "\tERROR slack is not a lower bound above the threshold (" << slack_threshold << ")" << endl;
+        return false;
+    }
+    return true;
+}
+
+std::pair<size_t,bool> verify_slack_bounds(const TimingGraph& tg, float slack_threshold, std::shared_ptr<TimingAnalyzer> ref_analyzer,  std::shared_ptr<TimingAnalyzer> check_analyzer) {
+    //Compares the worst slack of each node, which is exact only within the slack 
+    //threshold (see TimingAnalyzer::set_slack_threshold())
+    bool valid = true;
+    size_t nodes_checked = 0;
+
+    auto setup_ref_analyzer = std::dynamic_pointer_cast<SetupTimingAnalyzer>(ref_analyzer);
+    auto hold_ref_analyzer = std::dynamic_pointer_cast<HoldTimingAnalyzer>(ref_analyzer);
+    auto setup_check_analyzer = std::dynamic_pointer_cast<SetupTimingAnalyzer>(check_analyzer);
+    auto hold_check_analyzer = std::dynamic_pointer_cast<HoldTimingAnalyzer>(check_analyzer);
+
+    for (NodeId node : tg.nodes()) {
+        if (setup_ref_analyzer) {
+            TATUM_ASSERT(setup_check_analyzer);
+            valid &= verify_slack_bound(node, 
+                                        worst_slack(setup_check_analyzer->setup_slacks(node)), 
+                                        worst_slack(setup_ref_analyzer->setup_slacks(node)), 
+                                        slack_threshold, "setup_slack_bound");
+            ++nodes_checked;
+        }
+
+        if (hold_ref_analyzer) {
+            TATUM_ASSERT(hold_check_analyzer);
+            valid &= verify_slack_bound(node, 
+                                        worst_slack(hold_check_analyzer->hold_slacks(node)), 
+                                        worst_slack(hold_ref_analyzer->hold_slacks(node)), 
+                                        slack_threshold, "hold_slack_bound");
+            ++nodes_checked;
+        }
+    }
+
+    return {nodes_checked, valid};
+}
+
+static std::pair<size_t,bool> verify_corner_tags(const NodeId node, size_t corner, TimingTags::tag_range check_tags, TimingTags::tag_range ref_tags, std::string type) {
+    if (check_tags.size() != ref_tags.size()) {
+        cout << "Node: " << node << " " << type << " Calc: " << check_tags.size() << " tags Ref: " << ref_tags.size() << " tags" << endl;
+        cout << "\tERROR number of tags do not match" << endl;
+        return {0, false};
+    }
+
+    bool valid = true;
+    auto ref_iter = ref_tags.begin();
+    for (const TimingTag& check_tag : check_tags) {
+        TATUM_ASSERT(check_tag.type() == ref_iter->type());
+        valid &= verify_time(node, check_tag.launch_clock_domain(), check_tag.capture_clock_domain(), 
+                             check_tag.time().value(corner), ref_iter->time().value(), type);
+        ++ref_iter;
+    }
+    return {check_tags.size(), valid};
+}
+
+std::pair<size_t,bool> verify_corner(const TimingGraph& tg, size_t corner, std::shared_ptr<TimingAnalyzer> ref_analyzer,  std::shared_ptr<TimingAnalyzer> check_analyzer) {
+    //Compares the specified corner of check_analyzer against ref_analyzer, which
+    //analyzed only that corner's delays
+    bool valid = true;
+    size_t tags_checked = 0;
+
+    auto setup_ref_analyzer = std::dynamic_pointer_cast<SetupTimingAnalyzer>(ref_analyzer);
+    auto hold_ref_analyzer = std::dynamic_pointer_cast<HoldTimingAnalyzer>(ref_analyzer);
+    auto setup_check_analyzer = std::dynamic_pointer_cast<SetupTimingAnalyzer>(check_analyzer);
+    auto hold_check_analyzer = std::dynamic_pointer_cast<HoldTimingAnalyzer>(check_analyzer);
+
+    for (NodeId node : tg.nodes()) {
+        std::pair<size_t,bool> res;
+        if (setup_ref_analyzer) {
+            TATUM_ASSERT(setup_check_analyzer);
+            res = verify_corner_tags(node, corner, setup_check_analyzer->setup_tags(node), setup_ref_analyzer->setup_tags(node), "setup_corner_tag");
+            tags_checked += res.first;
+            valid &= res.second;
+
+            res = verify_corner_tags(node, corner, setup_check_analyzer->setup_slacks(node), setup_ref_analyzer->setup_slacks(node), "setup_corner_slack");
+            tags_checked += res.first;
+            valid &= res.second;
+        }
+
+        if (hold_ref_analyzer) {
+            TATUM_ASSERT(hold_check_analyzer);
+            res = verify_corner_tags(node, corner, hold_check_analyzer->hold_tags(node), hold_ref_analyzer->hold_tags(node), "hold_corner_tag");
+            tags_checked += res.first;
+            valid &= res.second;
+
+            res = verify_corner_tags(node, corner, hold_check_analyzer->hold_slacks(node), hold_ref_analyzer->hold_slacks(node), "hold_corner_slack");
+            tags_checked += res.first;
+            valid &= res.second;
+        }
+    }
+
+    return {tags_checked, valid};
+}
+
+bool verify_slack_summary(const TimingGraph& tg, const TimingConstraints& tc, const SlackSummary& summary, std::shared_ptr<TimingAnalyzer> ref_analyzer, bool check_domain_pairs) {
+    bool valid = true;
+
+    auto setup_ref_analyzer = std::dynamic_pointer_cast<SetupTimingAnalyzer>(ref_analyzer);
+    auto hold_ref_analyzer = std::dynamic_pointer_cast<HoldTimingAnalyzer>(ref_analyzer);
+
+    std::string type = (summary.type() == TimingType::SETUP) ? "setup" : "hold";
+
+    //Re-calculate the summary from scratch by scanning all endpoints
+    std::map<std::pair<DomainId,DomainId>,float> ref_worst_slacks;
+    std::map<std::pair<DomainId,DomainId>,double> ref_tns;
+    std::vector<float> ref_endpoint_worst_slacks;
+    double ref_total_tns = 0.;
+    for (NodeId node : tg.logical_outputs()) {
+        TimingTags::tag_range slacks = (summary.type() == TimingType::SETUP) ? setup_ref_analyzer->setup_slacks(node)
+                                                                              : hold_ref_analyzer->hold_slacks(node);
+        if (slacks.empty()) continue;
+
+        float endpoint_worst_slack = std::numeric_limits<float>::infinity();
+        for (const TimingTag& tag : slacks) {
+            auto key = std::make_pair(tag.launch_clock_domain(), tag.capture_clock_domain());
+            float slack = tag.time().value();
+
+            auto iter = ref_worst_slacks.find(key);
+            if (iter == ref_worst_slacks.end()) {
+                ref_worst_slacks[key] = slack;
+            } else {
+                iter->second = std::min(iter->second, slack);
+            }
+            ref_tns[key] += std::min(0.f, slack);
+
+            endpoint_worst_slack = std::min(endpoint_worst_slack, slack);
+        }
+        ref_endpoint_worst_slacks.push_back(endpoint_worst_slack);
+        ref_total_tns += std::min(0.f, endpoint_worst_slack);
+    }
+    std::sort(ref_endpoint_worst_slacks.begin(), ref_endpoint_worst_slacks.end());
+
+    //Per domain pair
+    auto domain_pairs = summary.domain_pairs();
+    if (!check_domain_pairs) {
+        //Pass
+    } else if (domain_pairs.size() != ref_worst_slacks.size()) {
+        cout << "ERROR " << type << " slack summary has " << domain_pairs.size() << " domain pairs, but expected " << ref_worst_slacks.size() << endl;
+        valid = false;
+    }
+
+    for (const auto& kv : ref_worst_slacks) {
+        if (!check_domain_pairs) break;
+
+        DomainId launch = kv.first.first;
+        DomainId capture = kv.first.second;
+
+        valid &= verify_time(NodeId::INVALID(), launch, capture, summary.worst_slack(launch, capture).value(), kv.second, type + "_summary_worst_slack");
+        valid &= verify_time(NodeId::INVALID(), launch, capture, summary.total_negative_slack(launch, capture).value(), ref_tns[kv.first], type + "_summary_tns");
+    }
+
+    //Overall
+    float ref_wns = ref_endpoint_worst_slacks.empty() ? 0. : std::min(0.f, ref_endpoint_worst_slacks[0]);
+    valid &= verify_time(NodeId::INVALID(), DomainId::INVALID(), DomainId::INVALID(), summary.worst_negative_slack().value(), ref_wns, type + "_summary_wns");
+    valid &= verify_time(NodeId::INVALID(), DomainId::INVALID(), DomainId::INVALID(), summary.total_negative_slack().value(), ref_total_tns, type + "_summary_tns");
+
+    //Worst endpoints (compared by slack, since ties may be ordered differently)
+    constexpr size_t NUM_WORST_ENDPOINTS = 10;
+    auto worst_endpoints = summary.worst_endpoints(NUM_WORST_ENDPOINTS);
+    if (worst_endpoints.size() != std::min(NUM_WORST_ENDPOINTS, ref_endpoint_worst_slacks.size())) {
+        cout << "ERROR " << type << " slack summary returned " << worst_endpoints.size() << " worst endpoints" << endl;
+        valid = false;
+    } else {
+        for (size_t i = 0; i < worst_endpoints.size(); ++i) {
+            valid &= verify_time(worst_endpoints[i].first, DomainId::INVALID(), DomainId::INVALID(), worst_endpoints[i].second.value(), ref_endpoint_worst_slacks[i], type + "_summary_worst_endpoint");
+        }
+    }
+
+    //Critical paths
+    if (check_domain_pairs && summary.type() == TimingType::SETUP) {
+        for (const TimingPathInfo& ref_path : find_critical_paths(tg, tc, *setup_ref_analyzer)) {
+            TimingPathInfo path = summary.critical_path(ref_path.launch_domain(), ref_path.capture_domain());
+            valid &= verify_time(path.endpoint(), path.launch_domain(), path.capture_domain(), path.delay().value(), ref_path.delay().value(), "setup_summary_cpd");
+        }
+    }
+
+    return valid;
+}
+
 std::pair<size_t,bool> verify_node_tags(const NodeId node, TimingTags::tag_range check_tags, TimingTags::tag_range ref_tags, std::string type) {
     bool error = false;
 
@@ -4,6 +4,8 @@
 
 #include "tatum/timing_analyzers_fwd.hpp"
 #include "tatum/TimingGraphFwd.hpp"
+#include "tatum/TimingConstraintsFwd.hpp"
+#include "tatum/SlackSummary.hpp"
 #include "tatum/delay_calc/DelayCalculator.hpp"
 #include "golden_reference.hpp"
 
@@ -11,4 +13,14 @@ std::pair<size_t,bool> verify_analyzer(const tatum::TimingGraph& tg, std::shared
 
 std::pair<size_t,bool> verify_equivalent_analysis(const tatum::TimingGraph& tg, const tatum::DelayCalculator& dc, std::shared_ptr<tatum::TimingAnalyzer> ref_analyzer,  std::shared_ptr<tatum::TimingAnalyzer> check_analyzer);
 
+std::pair<size_t,bool> verify_endpoint_worst_slacks(const tatum::TimingGraph& tg, std::shared_ptr<tatum::TimingAnalyzer> ref_analyzer,  std::shared_ptr<tatum::TimingAnalyzer> check_analyzer);
+
+std::pair<size_t,bool> verify_endpoint_slacks_between(const tatum::TimingGraph& tg, std::shared_ptr<tatum::TimingAnalyzer> lower_analyzer, std::shared_ptr<tatum::TimingAnalyzer> upper_analyzer, std::shared_ptr<tatum::TimingAnalyzer> check_analyzer);
+
+std::pair<size_t,bool> verify_slack_bounds(const tatum::TimingGraph& tg, float slack_threshold, std::shared_ptr<tatum::TimingAnalyzer> ref_analyzer,  std::shared_ptr<tatum::TimingAnalyzer> check_analyzer);
+
+std::pair<size_t,bool> verify_corner(const tatum::TimingGraph& tg, size_t corner, std::shared_ptr<tatum::TimingAnalyzer> ref_analyzer,  std::shared_ptr<tatum::TimingAnalyzer> check_analyzer);
+
+bool verify_slack_summary(const tatum::TimingGraph& tg, const tatum::TimingConstraints& tc, const tatum::SlackSummary& summary, std::shared_ptr<tatum::TimingAnalyzer> ref_analyzer, bool check_domain_pairs=true);
+
 #endif